@@ -0,0 +1,453 @@
+/*******************************************************************************
+ *  bench.cpp
+ *
+ *  Microbenchmarks for the game's hot spots.  This gets linked against all of
+ *  the game's sources except main.cpp (see 'make bench') and times each kernel
+ *  in isolation, drawing into a software renderer so no window or GPU is
+ *  needed.  All of the random number streams use a fixed seed, so every run
+ *  does exactly the same work.
+ *
+ *  Output is CSV on stdout, one line per benchmark:
+ *
+ *      benchmark,iterations,total_ms,ns_per_iteration
+ *
+ *  Usage:  belted-bench [NAME ...]     (no names runs them all)
+ *
+ *  Run it from the top directory so it can find data/.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "../src/util.h"
+#endif
+
+
+/*  Seed used for every benchmark */
+static const Uint64 BENCH_SEED = 20140630;
+
+/*  Scores get written during Scores::update(), so keep them out of data/ */
+static const char *BENCH_DAT_PATH = "bench-scores.dat";
+static const char *BENCH_TXT_PATH = "bench-scores.txt";
+
+/*  Target surface for the software renderer */
+static SDL_Surface *benchSurface = NULL;
+
+/*  State shared between the setup and the kernels */
+static Asteroids benchAsteroids;
+static AsteroidGrid benchGrid;
+static std::vector<Collider> *shipColliders = NULL;
+static std::vector<Collider> *asteroidColliders = NULL;
+static PixelMask *shipMask = NULL;
+static PixelMask *asteroidMask = NULL;
+static SDL_Surface *asteroidSurface = NULL;
+static SpriteSheet benchSheet;
+static AtariExplosion benchAtari;
+static int benchClouds[ 10 ] = { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 };
+static Uint32 benchCounter = 0;
+static Texture *benchText = NULL;
+
+/*  Names given on the command line, if any */
+static int benchArgc = 0;
+static char **benchArgv = NULL;
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                 RUN BENCHMARK
+--------------------------------------------------------------------------------
+ *  Run the kernel once to warm up, then time it over the given number of
+ *  iterations and print the results as a line of CSV.
+*/
+void run_benchmark( const char *name, void (*kernel)( void ), int iterations )
+{
+    /*  If they asked for specific benchmarks, skip anything else */
+    if( benchArgc > 0 )
+    {
+        bool wanted = false;
+        for( int i = 0; i < benchArgc; ++i )
+        {
+            if( strcmp( benchArgv[ i ], name ) == 0 )
+                wanted = true;
+        }
+
+        if( ! wanted )
+            return;
+    }
+
+    /*  Same random numbers every time */
+    seed_random( BENCH_SEED );
+
+    kernel();
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    for( int i = 0; i < iterations; ++i )
+        kernel();
+    Uint64 elapsed = SDL_GetPerformanceCounter() - start;
+
+    double ms = (double)elapsed * 1000.0 / (double)SDL_GetPerformanceFrequency();
+    printf("%s,%d,%.3f,%.1f\n", name, iterations, ms,
+            ms * 1000000.0 / iterations );
+    fflush( stdout );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                    KERNELS
+--------------------------------------------------------------------------------
+*/
+
+/*  Ship vs. asteroid, overlapping enough that they actually touch */
+void kernel_collision_hit( void )
+{
+    check_collision_colliders( *shipColliders, 300, 300,
+            *asteroidColliders, 300, 300 );
+}
+
+/*  Ship vs. asteroid, boxes overlap but the pixels never touch */
+void kernel_collision_miss( void )
+{
+    check_collision_colliders( *shipColliders, 300, 300, *asteroidColliders,
+            300 + player.get_width() - 12, 300 + player.get_height() - 12 );
+}
+
+/*  The same two cases, with pixel masks */
+void kernel_mask_hit( void )
+{
+    check_collision_masks( *shipMask, 300, 300, *asteroidMask, 300, 300 );
+}
+
+void kernel_mask_miss( void )
+{
+    check_collision_masks( *shipMask, 300, 300, *asteroidMask,
+            300 + player.get_width() - 12, 300 + player.get_height() - 12 );
+}
+
+/*  Build the colliders for every frame of the asteroid sprite sheet */
+void kernel_generate_colliders( void )
+{
+    benchSheet.init( asteroidSurface, 99, ASTEROID_FRAMES );
+}
+
+/*  Spawn an asteroid, as done several times a second during play */
+void kernel_asteroid_spawn( void )
+{
+    if( enemies.size() >= 1000 )
+        enemies.clear();
+
+    load_enemy();
+}
+
+/*  One tick of 5,000 asteroids:  move, cull and spawn replacements */
+void kernel_asteroids_update( void )
+{
+    benchAsteroids.update( 0, (int)benchAsteroids.size() );
+    benchAsteroids.cull();
+
+    while( benchAsteroids.size() < 5000 )
+    {
+        benchAsteroids.add( benchCounter % BWIDTH, -99, 1,
+                ( benchCounter % 6 + 1 ) * 2, benchCounter % 12 );
+        ++benchCounter;
+    }
+}
+
+/*  Draw 5,000 asteroids */
+void kernel_asteroids_render( void )
+{
+    benchAsteroids.render();
+}
+
+/*  Grid 5,000 asteroids and find the ones near a ship-sized rect */
+void kernel_asteroid_grid( void )
+{
+    static std::vector<int> found;
+    SDL_Rect rect = { BWIDTH / 2, BHEIGHT / 2, 77, 77 };
+
+    benchGrid.build( benchAsteroids );
+    benchGrid.query_rect( rect, found );
+}
+
+/*  Grid 5,000 asteroids and find the ones within a blast's reach */
+void kernel_asteroid_grid_radius( void )
+{
+    static std::vector<int> found;
+
+    benchGrid.build( benchAsteroids );
+    benchGrid.query_radius( BWIDTH / 2, BHEIGHT / 2, 150, found );
+}
+
+/*  One tick of the starfield */
+void kernel_starfield_update( void )
+{
+    starfield->update();
+}
+
+/*  Draw the starfield */
+void kernel_starfield_render( void )
+{
+    starfield->render();
+}
+
+/*  Move and draw ten explosions of debris, restarting them as they end */
+void kernel_debris_10( void )
+{
+    for( int e = 0; e < 10; ++e )
+    {
+        if( benchClouds[ e ] >= 0 && ! debris.is_done( benchClouds[ e ] ) )
+            continue;
+
+        if( benchClouds[ e ] >= 0 )
+            debris.free_cloud( benchClouds[ e ] );
+        benchClouds[ e ] = debris.add( e * 60, BHEIGHT / 2, 77, 77 );
+    }
+
+    debris.update( 0, debris.get_cloud_count() );
+    debris.render();
+}
+
+/*  One tick of an 'atari' explosion, restarting it when it's done */
+void kernel_atari_update( void )
+{
+    if( benchAtari.is_done() )
+    {
+        benchAtari = AtariExplosion();
+        benchAtari.init( BWIDTH / 2, BHEIGHT / 2, &colors[ COLOR_CYAN ] );
+    }
+
+    benchAtari.update();
+}
+
+/*  Sort, write and re-render the high scores */
+void kernel_scores_update( void )
+{
+    gScores->update();
+}
+
+/*  Render a score string into a texture of its own, as the panel used to */
+void kernel_text_texture( void )
+{
+    snprintf( currentScoreString, 9, "%06u", benchCounter++ );
+    benchText->create_texture_from_string( gFontTiny, currentScoreString,
+            colors[ COLOR_WHITE ] );
+}
+
+/*  Draw a score string from the glyph atlas, as the panel does now */
+void kernel_text_atlas( void )
+{
+    snprintf( currentScoreString, 9, "%06u", benchCounter++ );
+    gFontTinyAtlas->render( currentScoreString, 76, 50,
+            colors[ COLOR_WHITE ] );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                   BENCH INIT
+--------------------------------------------------------------------------------
+ *  Set up SDL with a software renderer, then load just what the kernels need
+*/
+bool bench_init( void )
+{
+    /*  No subsystems needed; we never open a window */
+    if( SDL_Init( 0 ) < 0 )
+    {
+        printf("ERROR:  Could not init SDL.  SDL Error:  %s\n",
+                SDL_GetError() );
+        return( false );
+    }
+
+    if( ( IMG_Init( IMG_INIT_PNG ) & IMG_INIT_PNG ) == false )
+    {
+        printf("ERROR:  Could not init SDL_image.  IMG Error:  %s\n",
+                IMG_GetError() );
+        return( false );
+    }
+
+    if( TTF_Init() == -1 )
+    {
+        printf("ERROR:  Could not init SDL_ttf.  TTF Error:  %s\n",
+                TTF_GetError() );
+        return( false );
+    }
+
+    /*  Software renderer drawing into a plain surface */
+    benchSurface = SDL_CreateRGBSurfaceWithFormat( 0, WWIDTH, WHEIGHT, 32,
+            SDL_PIXELFORMAT_ARGB8888 );
+    if( benchSurface == NULL )
+    {
+        printf("ERROR:  Could not create surface.  SDL Error:  %s\n",
+                SDL_GetError() );
+        return( false );
+    }
+
+    gRenderer = SDL_CreateSoftwareRenderer( benchSurface );
+    if( gRenderer == NULL )
+    {
+        printf("ERROR:  Could not create renderer.  SDL Error:  %s\n",
+                SDL_GetError() );
+        return( false );
+    }
+    SDL_SetRenderDrawBlendMode( gRenderer, SDL_BLENDMODE_BLEND );
+
+    /*  The usual non-SDL init */
+    seed_random( BENCH_SEED );
+    seedGiven = true;
+    BWIDTH = WWIDTH;
+    BHEIGHT = WHEIGHT - 100;
+    init_colors();
+
+    /*  Fonts and the sprite sheets */
+    if( ! load_fonts() || ! load_headless_media() )
+        return( false );
+
+    /*  Raw asteroid surface for SpriteSheet::init() */
+    asteroidSurface = IMG_Load( "data/gfx/asteroids.png" );
+    if( asteroidSurface == NULL )
+    {
+        printf("ERROR:  Could not load asteroids.  IMG Error:  %s\n",
+                IMG_GetError() );
+        return( false );
+    }
+
+    /*  Text texture for the text kernel */
+    benchText = new Texture();
+
+    /*  Scores, written somewhere harmless */
+    if( ! load_scores() )
+        return( false );
+    gScores->set_dat_file_path( BENCH_DAT_PATH );
+    gScores->set_txt_file_path( BENCH_TXT_PATH );
+
+    /*  The player's and a big asteroid's shapes for the collision kernels */
+    load_player();
+    player.set_position( 300, 300 );
+    shipColliders = &player.get_pixel_collider( player.get_current_frame() );
+    shipMask = &player.get_pixel_mask( player.get_current_frame() );
+
+    benchAsteroids.add( 300, 300, 1, 0, 0 );
+    asteroidColliders = &benchAsteroids.get_pixel_collider( 0 );
+    asteroidMask = &benchAsteroids.get_pixel_mask( 0 );
+    benchAsteroids.clear();
+
+    return( true );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                   BENCH CLOSE
+--------------------------------------------------------------------------------
+*/
+void bench_close( void )
+{
+    delete benchText;
+    delete gScores;
+    benchText = NULL;
+    gScores = NULL;
+
+    remove( BENCH_DAT_PATH );
+    remove( BENCH_TXT_PATH );
+
+    SDL_FreeSurface( asteroidSurface );
+    asteroidSurface = NULL;
+
+    close_headless();
+
+    SDL_DestroyRenderer( gRenderer );
+    gRenderer = NULL;
+    SDL_FreeSurface( benchSurface );
+    benchSurface = NULL;
+
+    delete gFontAtlas;
+    delete gFontSmallAtlas;
+    delete gFontTinyAtlas;
+    gFontAtlas = gFontSmallAtlas = gFontTinyAtlas = NULL;
+
+    TTF_CloseFont( gFont );
+    TTF_CloseFont( gFontSmall );
+    TTF_CloseFont( gFontTiny );
+    gFont = gFontSmall = gFontTiny = NULL;
+    TTF_Quit();
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                      MAIN
+--------------------------------------------------------------------------------
+*/
+int main( int argc, char *argv[] )
+{
+    benchArgc = argc - 1;
+    benchArgv = argv + 1;
+
+    if( ! bench_init() )
+    {
+        printf("ERROR:  Could not set up benchmarks.\n");
+        return( 1 );
+    }
+
+    printf("benchmark,iterations,total_ms,ns_per_iteration\n");
+
+    run_benchmark( "collision_colliders_hit", kernel_collision_hit, 20000 );
+    run_benchmark( "collision_colliders_miss", kernel_collision_miss, 20000 );
+    run_benchmark( "collision_mask_hit", kernel_mask_hit, 20000 );
+    run_benchmark( "collision_mask_miss", kernel_mask_miss, 20000 );
+    run_benchmark( "generate_colliders", kernel_generate_colliders, 200 );
+    run_benchmark( "asteroid_spawn", kernel_asteroid_spawn, 2000 );
+    enemies.clear();
+    run_benchmark( "asteroids_update_5000", kernel_asteroids_update, 500 );
+    run_benchmark( "asteroid_grid_5000", kernel_asteroid_grid, 500 );
+    run_benchmark( "asteroid_grid_radius", kernel_asteroid_grid_radius, 500 );
+    run_benchmark( "asteroids_render_5000", kernel_asteroids_render, 100 );
+    benchAsteroids.clear();
+
+    /*  Starfield at normal speed and full warp, after settling in */
+    int warps[] = { 1, 15 };
+    for( int w = 0; w < 2; ++w )
+    {
+        warpSpeed = warps[ w ];
+
+        seed_random( BENCH_SEED );
+        starfield = new Starfield();
+        for( int i = 0; i < 120; ++i )
+            starfield->update();
+
+        if( warpSpeed == 1 )
+        {
+            run_benchmark( "starfield_update_warp1",
+                    kernel_starfield_update, 2000 );
+            run_benchmark( "starfield_render_warp1",
+                    kernel_starfield_render, 500 );
+        }
+        else
+        {
+            run_benchmark( "starfield_update_warp15",
+                    kernel_starfield_update, 2000 );
+            run_benchmark( "starfield_render_warp15",
+                    kernel_starfield_render, 500 );
+        }
+
+        delete starfield;
+        starfield = NULL;
+    }
+    warpSpeed = 1;
+
+    player.set_position( BWIDTH / 2, BHEIGHT / 2 );
+    player.init_explosion();
+    run_benchmark( "debris_10", kernel_debris_10, 2000 );
+
+    run_benchmark( "atari_explosion_update", kernel_atari_update, 20000 );
+    run_benchmark( "scores_update", kernel_scores_update, 50 );
+    run_benchmark( "text_texture", kernel_text_texture, 2000 );
+    run_benchmark( "text_atlas", kernel_text_atlas, 2000 );
+
+    bench_close();
+
+    return( 0 );
+}
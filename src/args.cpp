@@ -38,6 +38,22 @@ void print_help( void )
     printf("  -l or --limit-fps:\tLimit FPS to 60, disable vsync\n");
     printf("  -m or --mute:\t\tStart with music and sound muted\n");
     printf("  -S or --story:\tPrint the backstory to your terminal\n");
+    printf("  --seed N:\t\tSeed the random number generators with N\n");
+    printf("  --profile-out FILE:\tWrite per-frame phase timings to FILE\n");
+    printf("\t\t\t(only in builds made with 'make profile')\n");
+    printf("  --record FILE:\t\tRecord a game's input to FILE\n");
+    printf("  --replay FILE:\t\tPlay back a game recorded with --record\n");
+    printf("  --headless [N]:\tSimulate N ticks of play with no window or\n");
+    printf("\t\t\taudio as fast as possible, then print stats\n");
+    printf("  --threaded:\t\tRun the simulation on its own thread\n");
+    printf("  --jobs N:\t\tUse N worker threads for updates (0 for none;\n");
+    printf("\t\t\tthe default is one per spare core)\n");
+    printf("  --stress N:\t\tSpawn N times as much of everything (N up to\n");
+    printf("\t\t\t%d) and report what it costs as the numbers\n",
+            MAX_STRESS_FACTOR );
+    printf("\t\t\tgrow (broken down by phase in builds made with\n");
+    printf("\t\t\t'make profile')\n");
+    printf("  --no-death:\t\tAsteroids can't kill the player\n");
 }
 
 
@@ -229,6 +245,104 @@ int check_args( int argc, char *argv[] )
         else if( arg == "-l" || arg == "--limit-fps" )
             limitFPS = true;
 
+        /*  If they want a reproducible run */
+        else if( arg == "--seed" )
+        {
+            if( argc > 2 )
+            {
+                seed_random( (Uint64)strtoull( argv[2], NULL, 10 ) );
+                seedGiven = true;
+                --argc;
+                ++argv;
+            }
+            else
+                printf("WARNING:  --seed needs a number\n");
+        }
+
+        /*  If they want per-frame timings written out */
+        else if( arg == "--profile-out" )
+        {
+            if( argc > 2 )
+            {
+#ifdef PROFILING
+                profileOutPath.assign( argv[2] );
+#else
+                printf("WARNING:  Not a profiling build; ignoring %s\n",
+                        argv[1] );
+#endif
+                --argc;
+                ++argv;
+            }
+            else
+                printf("WARNING:  --profile-out needs a file name\n");
+        }
+
+        /*  If they want to record or replay a game */
+        else if( arg == "--record" || arg == "--replay" )
+        {
+            if( argc > 2 )
+            {
+                replayPath.assign( argv[2] );
+                replayMode = ( arg == "--record" ) ? REPLAY_RECORD :
+                    REPLAY_PLAY;
+                --argc;
+                ++argv;
+            }
+            else
+                printf("WARNING:  %s needs a file name\n", argv[1] );
+        }
+
+        /*  If they want to run the simulation without any window or audio */
+        else if( arg == "--headless" )
+        {
+            headless = true;
+
+            /*  The number of ticks to run is optional */
+            if( argc > 2 && argv[2][0] >= '0' && argv[2][0] <= '9' )
+            {
+                headlessFrames = (Uint32)strtoul( argv[2], NULL, 10 );
+                --argc;
+                ++argv;
+            }
+        }
+
+        /*  If they want the simulation and rendering on separate threads */
+        else if( arg == "--threaded" )
+            threaded = true;
+
+        /*  If they want a particular number of worker threads */
+        else if( arg == "--jobs" )
+        {
+            if( argc > 2 )
+            {
+                jobThreads = (int)strtol( argv[2], NULL, 10 );
+                --argc;
+                ++argv;
+            }
+            else
+                printf("WARNING:  --jobs needs a number\n");
+        }
+
+        /*  If they want to see how things hold up with lots going on */
+        else if( arg == "--stress" )
+        {
+            long factor = ( argc > 2 ) ? strtol( argv[2], NULL, 10 ) : 0;
+            if( factor > 0 && factor <= MAX_STRESS_FACTOR )
+            {
+                stress = true;
+                stressFactor = (int)factor;
+                --argc;
+                ++argv;
+            }
+            else
+                printf("WARNING:  --stress needs a number from 1 to %d\n",
+                        MAX_STRESS_FACTOR );
+        }
+
+        /*  If they don't want the player to die */
+        else if( arg == "--no-death" )
+            noDeath = true;
+
         /*  Any other argument generates a warning */
         else
             printf("WARNING:  Unknown option:  '%s'\n", argv[1] );
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ *  asteroidgrid.cpp
+ *
+ *  This file defines the AsteroidGrid class, the broadphase for anything that
+ *  wants to know which asteroids are near a spot:  the player's collisions
+ *  and kisses, for starters.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*
+--------------------------------------------------------------------------------
+                                  CONSTRUCTOR
+--------------------------------------------------------------------------------
+*/
+AsteroidGrid::AsteroidGrid( void )
+{
+    mColumns = mRows = 0;
+    mMaxSize = 0;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                     BUILD
+--------------------------------------------------------------------------------
+ *  Count the asteroids in each cell, turn the counts into where each cell's
+ *  run starts, then drop each asteroid into its cell's run.  Asteroids go in
+ *  in order, so each cell's run stays sorted by index.
+*/
+void AsteroidGrid::build( Asteroids &asteroids )
+{
+    int count = (int)asteroids.size();
+
+    /*  The play area can change size between games */
+    mColumns = ( BWIDTH + ASTEROID_GRID_CELL - 1 ) / ASTEROID_GRID_CELL;
+    mRows = ( BHEIGHT + ASTEROID_GRID_CELL - 1 ) / ASTEROID_GRID_CELL;
+    if( mColumns < 1 )
+        mColumns = 1;
+    if( mRows < 1 )
+        mRows = 1;
+
+    int cells = mColumns * mRows;
+
+    mRects.resize( count );
+    mCells.resize( count );
+    mItems.resize( count );
+    mStarts.assign( cells + 1, 0 );
+    mMaxSize = 0;
+
+    /*  Count */
+    for( int i = 0; i < count; ++i )
+    {
+        SDL_Rect &rect = mRects[ i ];
+        rect = asteroids.get_swept_rect( i );
+
+        if( rect.w > mMaxSize )
+            mMaxSize = rect.w;
+        if( rect.h > mMaxSize )
+            mMaxSize = rect.h;
+
+        mCells[ i ] = ( get_row( rect.y ) * mColumns ) + get_column( rect.x );
+        ++mStarts[ mCells[ i ] + 1 ];
+    }
+
+    /*  Counts to starts */
+    for( int c = 0; c < cells; ++c )
+        mStarts[ c + 1 ] += mStarts[ c ];
+
+    /*  Fill in the runs, using each cell's start as a cursor */
+    for( int i = 0; i < count; ++i )
+        mItems[ mStarts[ mCells[ i ] ]++ ] = i;
+
+    /*  That left each start where the next cell's is, so shift them back */
+    for( int c = cells; c > 0; --c )
+        mStarts[ c ] = mStarts[ c - 1 ];
+    mStarts[ 0 ] = 0;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   QUERY RECT
+--------------------------------------------------------------------------------
+*/
+void AsteroidGrid::query_rect( SDL_Rect &rect, std::vector<int> &found )
+{
+    found.clear();
+
+    int left, top, right, bottom;
+    get_cells( rect, &left, &top, &right, &bottom );
+
+    for( int row = top; row <= bottom; ++row )
+    {
+        for( int col = left; col <= right; ++col )
+        {
+            int c = ( row * mColumns ) + col;
+            for( int n = mStarts[ c ]; n < mStarts[ c + 1 ]; ++n )
+            {
+                if( check_collision_box( rect, mRects[ mItems[ n ] ] ) )
+                    found.push_back( mItems[ n ] );
+            }
+        }
+    }
+
+    /*  Several cells' worth of runs, each in order */
+    std::sort( found.begin(), found.end() );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                  QUERY RADIUS
+--------------------------------------------------------------------------------
+*/
+void AsteroidGrid::query_radius( int x, int y, int radius,
+        std::vector<int> &found )
+{
+    found.clear();
+
+    SDL_Rect bounds = { x - radius, y - radius, radius * 2, radius * 2 };
+    Circle circle = { x, y, radius };
+
+    int left, top, right, bottom;
+    get_cells( bounds, &left, &top, &right, &bottom );
+
+    for( int row = top; row <= bottom; ++row )
+    {
+        for( int col = left; col <= right; ++col )
+        {
+            int c = ( row * mColumns ) + col;
+            for( int n = mStarts[ c ]; n < mStarts[ c + 1 ]; ++n )
+            {
+                if( check_collision_rect_circ( mRects[ mItems[ n ] ],
+                            circle ) )
+                    found.push_back( mItems[ n ] );
+            }
+        }
+    }
+
+    std::sort( found.begin(), found.end() );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   GET CELLS
+--------------------------------------------------------------------------------
+ *  Asteroids are filed by their top left corner, so one overlapping the area
+ *  could be filed as much as the biggest swept rect's size up and to the left
+ *  of it
+*/
+void AsteroidGrid::get_cells( SDL_Rect &rect, int *left, int *top, int *right,
+        int *bottom )
+{
+    *left = get_column( rect.x - mMaxSize );
+    *top = get_row( rect.y - mMaxSize );
+    *right = get_column( rect.x + rect.w );
+    *bottom = get_row( rect.y + rect.h );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                 GET COLUMN / ROW
+--------------------------------------------------------------------------------
+*/
+int AsteroidGrid::get_column( int x )
+{
+    if( x < 0 )
+        return( 0 );
+
+    int col = x / ASTEROID_GRID_CELL;
+    return( ( col < mColumns ) ? col : mColumns - 1 );
+}
+
+int AsteroidGrid::get_row( int y )
+{
+    if( y < 0 )
+        return( 0 );
+
+    int row = y / ASTEROID_GRID_CELL;
+    return( ( row < mRows ) ? row : mRows - 1 );
+}
@@ -0,0 +1,81 @@
+/*******************************************************************************
+ *  asteroidgrid.h
+ *
+ *  This is the header file for the AsteroidGrid class, defined in
+ *  asteroidgrid.cpp, which sorts the asteroids by where they are so we can
+ *  find the ones near something without looking at all of them.
+ *
+*******************************************************************************/
+#ifndef CLASS_ASTEROID_GRID_H
+#define CLASS_ASTEROID_GRID_H
+
+/*  Width and height of a grid cell, in pixels */
+#define ASTEROID_GRID_CELL 128
+
+/*
+ *  The AsteroidGrid class
+ *
+ *  A uniform grid over the play area.  It's built from scratch on any tick
+ *  that needs it, once the asteroids have moved, which is a couple of passes
+ *  over them (a counting sort by cell) and doesn't allocate once it's warmed
+ *  up.
+ *
+ *  Each asteroid is filed by the area it swept through over the last tick
+ *  (see Asteroids::get_swept_rect()), so fast asteroids can't skip over
+ *  anything.  It goes in the cell the top left corner of that area is in;
+ *  anything off the edge of the play area goes in the nearest cell.
+ *
+ *  Queries look at every cell that the biggest swept rect could reach in
+ *  from, then check the actual rects, so they find exactly the asteroids
+ *  that overlap (never a superset).
+ *
+ *  The results are indices into the asteroids the grid was built from, in
+ *  increasing order, and are only good until those asteroids change.
+ */
+class AsteroidGrid
+{
+    public:
+        /*  Constructor */
+        AsteroidGrid( void );
+
+        /*  Sort the asteroids into the grid */
+        void build( Asteroids &asteroids );
+
+        /*  Asteroids whose swept rects overlap the given rect */
+        void query_rect( SDL_Rect &rect, std::vector<int> &found );
+
+        /*  Asteroids whose swept rects overlap the given circle */
+        void query_radius( int x, int y, int radius,
+                std::vector<int> &found );
+
+    private:
+        /*  The range of cells covering the given area, widened as need be */
+        void get_cells( SDL_Rect &rect, int *left, int *top, int *right,
+                int *bottom );
+
+        /*  Cell a point is in (clamped to the grid) */
+        int get_column( int x );
+        int get_row( int y );
+
+        /*  Size of the grid, in cells */
+        int mColumns;
+        int mRows;
+
+        /*  Biggest swept rect in the grid (width or height) */
+        int mMaxSize;
+
+        /*  Each asteroid's swept rect, by asteroid index */
+        std::vector<SDL_Rect> mRects;
+
+        /*  Each asteroid's cell, by asteroid index */
+        std::vector<int> mCells;
+
+        /*
+         *  The asteroids in cell c are mItems[ mStarts[ c ] ] up to (but not
+         *  including) mItems[ mStarts[ c + 1 ] ]
+         */
+        std::vector<int> mStarts;
+        std::vector<int> mItems;
+};
+
+#endif
@@ -0,0 +1,482 @@
+/*******************************************************************************
+ *  asteroids.cpp
+ *
+ *  This file defines the asteroids class, which keeps every asteroid in the
+ *  game in one place:  moving them, blowing them up, checking them against
+ *  the player and drawing them.
+ *
+ *  Each asteroid used to be a full-blown ship object of its own, with its own
+ *  copy of the clips, thirty vectors of colliders and room for 400 particles
+ *  of debris; about 15 KB apiece, copied whenever one was added and shifted
+ *  whenever one before it was erased.  Now the things looked at every tick
+ *  take a couple of dozen bytes per asteroid, the clips and colliders come
+ *  from a sprite sheet made once for each size, debris lives in the debris
+ *  pool only while an asteroid is actually exploding, and getting rid of
+ *  asteroids doesn't shift the rest.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*  Shared by every asteroid */
+Texture *Asteroids::mTexture = NULL;
+SpriteSheet *Asteroids::mSheets[ ASTEROID_SCALES + 1 ];
+int Asteroids::mSizes[ ASTEROID_SCALES + 1 ];
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                  CONSTRUCTOR
+--------------------------------------------------------------------------------
+*/
+Asteroids::Asteroids( void )
+{
+    mX.reserve( ASTEROIDS_MAX );
+    mY.reserve( ASTEROIDS_MAX );
+    mPrevY.reserve( ASTEROIDS_MAX );
+    mVelocity.reserve( ASTEROIDS_MAX );
+    mDirection.reserve( ASTEROIDS_MAX );
+    mScale.reserve( ASTEROIDS_MAX );
+    mFrame.reserve( ASTEROIDS_MAX );
+    mFlags.reserve( ASTEROIDS_MAX );
+    mPointsKissed.reserve( ASTEROIDS_MAX );
+    mPointsKilled.reserve( ASTEROIDS_MAX );
+    mDebrisIndex.reserve( ASTEROIDS_MAX );
+    mClearance.reserve( ASTEROIDS_MAX );
+    mRemoved.reserve( ASTEROIDS_MAX );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   DESTRUCTOR
+--------------------------------------------------------------------------------
+*/
+Asteroids::~Asteroids( void )
+{
+    clear();
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                  INIT SHAPES
+--------------------------------------------------------------------------------
+ *  The sheets are built by load_sprite_sheets(); we only keep the sizes to
+ *  hand, since those get looked at for every asteroid every tick.
+*/
+void Asteroids::init_shapes( Texture *texture, SpriteSheet **sheets )
+{
+    mTexture = texture;
+
+    mSheets[ 0 ] = NULL;
+    mSizes[ 0 ] = 0;
+    for( int scale = 1; scale <= ASTEROID_SCALES; ++scale )
+    {
+        mSheets[ scale ] = sheets[ scale ];
+        mSizes[ scale ] = sheets[ scale ]->get_size();
+    }
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                     CLEAR
+--------------------------------------------------------------------------------
+ *  Get rid of the asteroids, but hang on to the room they took up.  Their
+ *  debris is left to debris.clear().
+*/
+void Asteroids::clear( void )
+{
+    mX.clear();
+    mY.clear();
+    mPrevY.clear();
+    mVelocity.clear();
+    mDirection.clear();
+    mScale.clear();
+    mFrame.clear();
+    mFlags.clear();
+    mPointsKissed.clear();
+    mPointsKilled.clear();
+    mDebrisIndex.clear();
+    mClearance.clear();
+    mRemoved.clear();
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      SIZE
+--------------------------------------------------------------------------------
+*/
+size_t Asteroids::size( void )
+{
+    return( mX.size() );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      ADD
+--------------------------------------------------------------------------------
+ *  Add a new, live asteroid heading downward.  Smaller, faster asteroids are
+ *  worth more points when kissed or killed.  The arrays already have room for
+ *  it, so this is just filling in the next slot.
+*/
+bool Asteroids::add( int x, int y, int scale, int velocity, int frame )
+{
+    if( mX.size() >= ASTEROIDS_MAX )
+        return( false );
+
+    mX.push_back( x );
+    mY.push_back( y );
+    mPrevY.push_back( y );
+    mVelocity.push_back( (Sint8)velocity );
+    mDirection.push_back( 1 );
+    mScale.push_back( (Uint8)scale );
+    mFrame.push_back( (Uint8)frame );
+    mFlags.push_back( ASTEROID_ALIVE );
+    mPointsKissed.push_back( (Uint16)( 20 + ( scale * 10 ) +
+                ( velocity * 5 ) ) );
+    mPointsKilled.push_back( (Uint16)( 50 + ( scale * 15 ) +
+                ( velocity * 5 ) ) );
+    mDebrisIndex.push_back( -1 );
+    mClearance.push_back( -1 );
+
+    return( true );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                     UPDATE
+--------------------------------------------------------------------------------
+ *  Remember where each asteroid was as of the last tick (for smooth
+ *  rendering) and move it.  An asteroid that's been blown up is done
+ *  exploding once its debris has all faded out.
+ *  Nothing outside of asteroids [begin, end) gets touched, so different
+ *  ranges can be updated at the same time.
+*/
+void Asteroids::update( int begin, int end )
+{
+    for( int i = begin; i < end; ++i )
+    {
+        mPrevY[ i ] = mY[ i ];
+        mY[ i ] += ( mVelocity[ i ] * mDirection[ i ] ) * warpSpeed;
+
+        if( ( mFlags[ i ] & ASTEROID_EXPLODING ) &&
+                debris.is_done( mDebrisIndex[ i ] ) )
+            mFlags[ i ] &= ~ASTEROID_EXPLODING;
+    }
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                UPDATE CLEARANCE
+--------------------------------------------------------------------------------
+ *  Each asteroid keeps a clearance:  a lower bound on how far apart its swept
+ *  rect and the player's rect are, along whichever axis they're furthest
+ *  apart on.  Less than zero means they might overlap.
+ *
+ *  Nothing can close that gap faster than the asteroid's own move (its
+ *  velocity times warpSpeed) plus the player's, so each tick we just knock
+ *  both off.  As long as it stays at zero or more, the asteroid can't be
+ *  touching the player and we don't look any closer.  Once it runs out, we
+ *  measure the real gap and start counting down from that.
+ *
+ *  The player's mouse movement has no top speed (the ship goes wherever the
+ *  mouse does), so it's how far the player actually moved that gets used.
+ *
+ *  Nothing outside of asteroids [begin, end) gets touched, so different
+ *  ranges can be updated at the same time.
+*/
+int Asteroids::update_clearance( int begin, int end, SDL_Rect &rect,
+        int moved, int *skipped )
+{
+    int touching = 0;
+    int skips = 0;
+
+    for( int i = begin; i < end; ++i )
+    {
+        int move = mY[ i ] - mPrevY[ i ];
+        if( move < 0 )
+            move = -move;
+
+        mClearance[ i ] -= move + moved;
+        if( mClearance[ i ] >= 0 )
+        {
+            ++skips;
+            continue;
+        }
+
+        /*  Out of clearance, so measure how far apart they really are */
+        SDL_Rect swept = get_swept_rect( i );
+
+        int gapX = swept.x - ( rect.x + rect.w );
+        if( rect.x - ( swept.x + swept.w ) > gapX )
+            gapX = rect.x - ( swept.x + swept.w );
+
+        int gapY = swept.y - ( rect.y + rect.h );
+        if( rect.y - ( swept.y + swept.h ) > gapY )
+            gapY = rect.y - ( swept.y + swept.h );
+
+        mClearance[ i ] = ( gapX > gapY ) ? gapX : gapY;
+        if( mClearance[ i ] < 0 )
+            ++touching;
+    }
+
+    *skipped += skips;
+    return( touching );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      CULL
+--------------------------------------------------------------------------------
+ *  Erase asteroids that have gone beyond the visible play area, and ones that
+ *  are dead and done exploding.  The holes get filled from the end of the
+ *  arrays, so this costs the same however many asteroids are left, and the
+ *  order of the rest changes.
+*/
+void Asteroids::cull( void )
+{
+    mRemoved.clear();
+
+    for( size_t i = 0; i < mX.size(); ++i )
+    {
+        if( mY[ i ] > BHEIGHT || ! ( mFlags[ i ] &
+                    ( ASTEROID_ALIVE | ASTEROID_EXPLODING ) ) )
+        {
+            /*  Its debris slot is free for the next explosion */
+            if( mDebrisIndex[ i ] >= 0 )
+                debris.free_cloud( mDebrisIndex[ i ] );
+
+            mRemoved.push_back( i );
+        }
+    }
+
+    if( mRemoved.empty() )
+        return;
+
+    mX.compact( mRemoved );
+    mY.compact( mRemoved );
+    mPrevY.compact( mRemoved );
+    mVelocity.compact( mRemoved );
+    mDirection.compact( mRemoved );
+    mScale.compact( mRemoved );
+    mFrame.compact( mRemoved );
+    mFlags.compact( mRemoved );
+    mPointsKissed.compact( mRemoved );
+    mPointsKilled.compact( mRemoved );
+    mDebrisIndex.compact( mRemoved );
+    mClearance.compact( mRemoved );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      KISS
+--------------------------------------------------------------------------------
+ *  This function defines what happens when the player 'kisses' an asteroid.
+ *  In this game, a 'kiss' is when the player honks while near an asteroid to
+ *  earn extra points.
+ *
+ *  The reason it's called a 'kiss' is because, initially, the player would
+ *  earn these extra points just by flying near the asteroid; the terminology
+ *  is an homage to those 'Aaaaaa' games.  The way the points were earned was
+ *  changed because it was way too easy to rack up points initially, and I
+ *  just haven't bothered to change the name.
+*/
+void Asteroids::kiss( int i )
+{
+    /*
+     *  An asteroid can only be kissed if it hasn't already been kissed, the
+     *  player is alive and the player isn't invulnerable (temporary
+     *  invulnerability after respawn).
+     */
+    if( ! ( mFlags[ i ] & ASTEROID_KISSED ) && player.is_alive() &&
+            ! player.is_invulnerable() )
+    {
+        /*  Create the kiss string of text */
+        char kissString[ 16 ];
+        snprintf( kissString, 16, "+%d", mPointsKissed[ i ] );
+
+        /*  Add this to the kissKills object thingy */
+        kissKills.add( mX[ i ], mY[ i ], kissString, colors[ COLOR_GREEN ] );
+
+        /*  This asteroid has now been kissed */
+        mFlags[ i ] |= ASTEROID_KISSED;
+
+        /*  Play the kiss sound effect */
+        play_sound( soundEffectKiss );
+
+        /*  Increase score counters appropriately */
+        currentScore += mPointsKissed[ i ];
+        extraLifeScore += mPointsKissed[ i ];
+
+        /*  Also counts toward charge score if the player isn't charged */
+        if( ! player.is_powered() )
+            chargeScore += mPointsKissed[ i ];
+    }
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      KILL
+--------------------------------------------------------------------------------
+ *  This function defines what happens when an asteroid is destroyed
+*/
+void Asteroids::kill( int i )
+{
+    /*  An asteroid can't be killed if it's already dead, obviously */
+    if( ! ( mFlags[ i ] & ASTEROID_ALIVE ) )
+        return;
+
+    /*  Increase score counters appropriately */
+    currentScore += mPointsKilled[ i ];
+    extraLifeScore += mPointsKilled[ i ];
+
+    if( ! player.is_powered() )
+        chargeScore += mPointsKilled[ i ];
+
+    /*  Blow it up */
+    int size = mSizes[ mScale[ i ] ];
+    mDebrisIndex[ i ] = debris.add( mX[ i ], mY[ i ], size, size );
+    mFlags[ i ] = ( mFlags[ i ] & ~ASTEROID_ALIVE ) | ASTEROID_EXPLODING;
+
+    /*  Init special 'atari' explosion */
+    AtariExplosion aExplosion;
+    aExplosion.init( mX[ i ], mY[ i ], player.get_special_color() );
+    aExplosions.push_back( aExplosion );
+
+    /*  Create kill text texture string */
+    char killString[ 16 ];
+    snprintf( killString, 16, " +%d", mPointsKilled[ i ] );
+
+    /*  Add text to kiss/kill thingy */
+    kissKills.add( mX[ i ], mY[ i ], killString, colors[ COLOR_HOT_PINK ] );
+
+    /*  Play asteroid explosion sound effect */
+    play_sound( soundEffectExplosion2 );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                 ASTEROID INFO
+--------------------------------------------------------------------------------
+*/
+bool Asteroids::is_alive( int i )
+{
+    return( mFlags[ i ] & ASTEROID_ALIVE );
+}
+
+bool Asteroids::is_exploding( int i )
+{
+    return( mFlags[ i ] & ASTEROID_EXPLODING );
+}
+
+SDL_Rect Asteroids::get_rect( int i )
+{
+    SDL_Rect rect;
+    rect.x = mX[ i ];
+    rect.y = mY[ i ];
+    rect.w = rect.h = mSizes[ mScale[ i ] ];
+
+    return( rect );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                 GET SWEPT RECT
+--------------------------------------------------------------------------------
+ *  The area the asteroid passed through over the last tick:  its rect, run
+ *  from where it was to where it is
+*/
+SDL_Rect Asteroids::get_swept_rect( int i )
+{
+    SDL_Rect rect = get_rect( i );
+
+    if( mPrevY[ i ] < rect.y )
+    {
+        rect.h += rect.y - mPrevY[ i ];
+        rect.y = mPrevY[ i ];
+    }
+    else
+        rect.h += mPrevY[ i ] - rect.y;
+
+    return( rect );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   GET PREV Y
+--------------------------------------------------------------------------------
+ *  Where the asteroid was as of the previous tick
+*/
+int Asteroids::get_prev_y( int i )
+{
+    return( mPrevY[ i ] );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                               GET PIXEL COLLIDER
+--------------------------------------------------------------------------------
+ *  The asteroid's colliders, relative to its position (see get_rect())
+*/
+std::vector<Collider>& Asteroids::get_pixel_collider( int i )
+{
+    return( mSheets[ mScale[ i ] ]->get_colliders( mFrame[ i ] ) );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                 GET PIXEL MASK
+--------------------------------------------------------------------------------
+ *  The asteroid's mask, relative to its position (see get_rect())
+*/
+PixelMask& Asteroids::get_pixel_mask( int i )
+{
+    return( mSheets[ mScale[ i ] ]->get_mask( mFrame[ i ] ) );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                     RENDER
+--------------------------------------------------------------------------------
+ *  Live asteroids get drawn between where they were last tick and where they
+ *  are now (see tickInterpolation).  Dead ones are just debris now, which
+ *  the debris pool draws.
+ *
+ *  They all come from the one texture, so they go through the sprite batch
+ *  and get drawn in a single call.
+*/
+void Asteroids::render( void )
+{
+    for( size_t i = 0; i < mX.size(); ++i )
+    {
+        if( mFlags[ i ] & ASTEROID_ALIVE )
+        {
+            int size = mSizes[ mScale[ i ] ];
+            int y = mPrevY[ i ] + (int)( ( mY[ i ] - mPrevY[ i ] ) *
+                    tickInterpolation );
+
+            spriteBatch.add( mTexture, mX[ i ], y, size, size,
+                    mSheets[ mScale[ i ] ]->get_clip( mFrame[ i ] ) );
+        }
+    }
+
+    spriteBatch.flush();
+}
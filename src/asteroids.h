@@ -0,0 +1,126 @@
+/*******************************************************************************
+ *  asteroids.h
+ *
+ *  This is the header file for the asteroids class, defined in asteroids.cpp,
+ *  which holds every asteroid (enemy) in the game.
+ *
+*******************************************************************************/
+#ifndef CLASS_ASTEROIDS_H
+#define CLASS_ASTEROIDS_H
+
+/*  Frames in the asteroid sprite sheet */
+#define ASTEROID_FRAMES 12
+
+/*
+ *  Asteroids come in this many sizes, from full size (scale 1) on down to the
+ *  smallest (scale ASTEROID_SCALES); see load_sprite_sheets()
+ */
+#define ASTEROID_SCALES 4
+
+/*  Most asteroids there can be at once */
+#define ASTEROIDS_MAX 8192
+
+/*  Bits of an asteroid's flags */
+enum asteroidFlags
+{
+    ASTEROID_ALIVE = 1,         //  Still in one piece
+    ASTEROID_KISSED = 2,        //  The player honked at it already
+    ASTEROID_EXPLODING = 4      //  Its debris is still flying around
+};
+
+/*
+ *  The Asteroids class
+ *
+ *  Asteroids are kept as a structure of arrays:  everything the update loop
+ *  and the collision checks look at every tick is in its own small, tightly
+ *  packed array, indexed by asteroid.  The bulky stuff is elsewhere; the
+ *  debris of an exploding asteroid lives in the debris pool, referred to by
+ *  index, and the clips and colliders come from a sprite sheet for each size.
+ *
+ *  The arrays have room for ASTEROIDS_MAX asteroids from the start, and the
+ *  debris pool recycles its slots, so once a game has warmed up adding and
+ *  blowing up asteroids doesn't touch the heap.
+ */
+class Asteroids
+{
+    public:
+        /*  Constructor */
+        Asteroids( void );
+
+        /*  Destructor */
+        ~Asteroids( void );
+
+        /*
+         *  Set the texture and the sprite sheet for each scale (indexed by
+         *  scale).  This has to be done once, before any asteroids are added.
+         */
+        static void init_shapes( Texture *texture, SpriteSheet **sheets );
+
+        /*  Get rid of every asteroid */
+        void clear( void );
+
+        /*  Number of asteroids */
+        size_t size( void );
+
+        /*
+         *  Add an asteroid of the given scale, velocity and frame.  Returns
+         *  false if there's no room for it.
+         */
+        bool add( int x, int y, int scale, int velocity, int frame );
+
+        /*  Move asteroids [begin, end) along by a tick */
+        void update( int begin, int end );
+
+        /*
+         *  Work out which of asteroids [begin, end) could be touching the
+         *  given rect, which has moved 'moved' pixels (at most, either way)
+         *  since the last call.  Returns how many could be, and adds how many
+         *  were ruled out without even looking to 'skipped'.
+         */
+        int update_clearance( int begin, int end, SDL_Rect &rect, int moved,
+                int *skipped );
+
+        /*  Get rid of asteroids that are off the screen or all blown up */
+        void cull( void );
+
+        /*  Things that happen to a particular asteroid */
+        void kiss( int i );
+        void kill( int i );
+
+        /*  About a particular asteroid */
+        bool is_alive( int i );
+        bool is_exploding( int i );
+        SDL_Rect get_rect( int i );
+        SDL_Rect get_swept_rect( int i );
+        int get_prev_y( int i );
+        std::vector<Collider>& get_pixel_collider( int i );
+        PixelMask& get_pixel_mask( int i );
+
+        /*  Draw every live asteroid */
+        void render( void );
+
+    private:
+        /*  Hot data, one entry per asteroid */
+        DenseArray<int> mX;
+        DenseArray<int> mY;
+        DenseArray<int> mPrevY;             //  Y as of the previous tick
+        DenseArray<Sint8> mVelocity;
+        DenseArray<Sint8> mDirection;       //  1 = down, -1 = up
+        DenseArray<Uint8> mScale;
+        DenseArray<Uint8> mFrame;
+        DenseArray<Uint8> mFlags;           //  ASTEROID_* bits
+        DenseArray<Uint16> mPointsKissed;
+        DenseArray<Uint16> mPointsKilled;
+        DenseArray<int> mDebrisIndex;       //  Cloud in debris, or -1
+        DenseArray<int> mClearance;         //  See update_clearance()
+
+        /*  Asteroids cull() is getting rid of */
+        std::vector<size_t> mRemoved;
+
+        /*  Shared by every asteroid */
+        static Texture *mTexture;
+        static SpriteSheet *mSheets[ ASTEROID_SCALES + 1 ];
+        static int mSizes[ ASTEROID_SCALES + 1 ];
+};
+
+#endif
@@ -46,11 +46,12 @@ void AtariExplosion::init( int x, int y, SDL_Color *color )
     /*  Init the color */
     mColor = color;
 
-    /*  Used for random left/right up/down choices */
-    int choices[] = { -1, 1 };
+    /*  Random numbers come from the effects stream */
+    Random &r = rng[ RNG_EFFECTS ];
 
     /*  Create at least twenty squares for the explosion */
-    for( int i = 0; i < ( (rand()%100) + 20 ); ++i )
+    int squares = r.range( 100 ) + 20;
+    for( int i = 0; i < squares; ++i )
     {
         /*  Create this to store position / dimensions */
         ARect arect;
@@ -60,16 +61,16 @@ void AtariExplosion::init( int x, int y, SDL_Color *color )
         arect.pos.y = y;
 
         /*  Set target position */
-        arect.target.x = x + ( (( rand()%50 ) + 20) * choices[ rand()%2 ] );
-        arect.target.y = y + ( (( rand()%50 ) + 20) * choices[ rand()%2 ] );
+        arect.target.x = x + ( ( r.range( 50 ) + 20 ) * r.sign() );
+        arect.target.y = y + ( ( r.range( 50 ) + 20 ) * r.sign() );
 
         /*  Init velocity */
-        arect.velocity.x = ( rand() % 10 ) + 5;
-        arect.velocity.y = ( rand() % 10 ) + 5;
+        arect.velocity.x = r.range( 10 ) + 5;
+        arect.velocity.y = r.range( 10 ) + 5;
 
         /*  Random width, random height */
-        arect.w = ( rand() % 200 ) + 50;
-        arect.h = ( rand() % 60 ) + 20;
+        arect.w = r.range( 200 ) + 50;
+        arect.h = r.range( 60 ) + 20;
 
         /*  Init the alpha value to full */
         arect.a = 255;
@@ -95,19 +96,20 @@ void AtariExplosion::render( void )
     /*  The draw rect, which will be set to that of each explosion rect */
     SDL_Rect dRect;
 
-    /*  Iterate along the explosion rects vector */
-    std::vector<ARect>::iterator r;
-    for( r = mExplosionRects.begin(); r != mExplosionRects.end(); ++r )
+    /*  Iterate along the explosion rects */
+    for( size_t i = 0; i < mExplosionRects.size(); ++i )
     {
+        const ARect &r = mExplosionRects[ i ];
+
         /*  Set the draw rect to the position / dimensions of the expl. rect */
-        dRect.x = r->pos.x;
-        dRect.y = r->pos.y;
-        dRect.w = r->w;
-        dRect.h = r->h;
+        dRect.x = r.pos.x;
+        dRect.y = r.pos.y;
+        dRect.w = r.w;
+        dRect.h = r.h;
 
         /*  Set the render draw color to the values we need */
         SDL_SetRenderDrawColor( gRenderer,
-                mColor->r, mColor->g, mColor->b, r->a );
+                mColor->r, mColor->g, mColor->b, r.a );
 
         /*  Draw the rectangle onto the screen */
         SDL_RenderFillRect( gRenderer, &dRect );
@@ -128,43 +130,40 @@ void AtariExplosion::update( SDL_Color *color )
     if( color != NULL )
         mColor = color;
 
-    /*  Create the iterator for the explosions rect vector */
-    std::vector<ARect>::iterator r;
-
-    /*  First, get rid of all the dead rects */
-    for( r = mExplosionRects.begin(); r != mExplosionRects.end(); )
+    /*  Iterate along the explosion rects and update them */
+    for( size_t i = 0; i < mExplosionRects.size(); ++i )
     {
-        /*  If the rect is done, erase it from the vector */
-        if( r->done )
-            mExplosionRects.erase( r );
+        ARect &r = mExplosionRects[ i ];
 
-        /*  Otherwise, keep on moving */
-        else
-            ++r;
-    }
+        /*  If the rect is done, get rid of it */
+        if( r.done )
+        {
+            mExplosionRects.remove( i );
+            continue;
+        }
 
-    /*  Next, iterate along the explosion rects vector and update the rects */
-    for( r = mExplosionRects.begin(); r != mExplosionRects.end(); ++r )
-    {
         /*  Move along the X axis */
-        if( r->pos.x < r->target.x )
-            r->pos.x += r->velocity.x;
-        else if( r->pos.x > r->target.x )
-            r->pos.x -= r->velocity.x;
+        if( r.pos.x < r.target.x )
+            r.pos.x += r.velocity.x;
+        else if( r.pos.x > r.target.x )
+            r.pos.x -= r.velocity.x;
 
         /*  Move along the Y axis */
-        if( r->pos.y < r->target.y )
-            r->pos.y += r->velocity.y;
-        else if( r->pos.y > r->target.y )
-            r->pos.y -= r->velocity.y;
+        if( r.pos.y < r.target.y )
+            r.pos.y += r.velocity.y;
+        else if( r.pos.y > r.target.y )
+            r.pos.y -= r.velocity.y;
 
         /*  Adjust alpha value (fade out) */
-        if( r->a >= 32 )
-            r->a -= 32;
+        if( r.a >= 32 )
+            r.a -= 32;
         else
-            r->done = true;
+            r.done = true;
 
     }
+
+    /*  Fill in the holes the dead rects left */
+    mExplosionRects.compact();
 }
 
 
@@ -173,7 +172,7 @@ void AtariExplosion::update( SDL_Color *color )
 --------------------------------------------------------------------------------
                                     IS DONE
 --------------------------------------------------------------------------------
- *  Returns whether or not the vector is entirely clear of explosion rects
+ *  Returns whether or not we're entirely clear of explosion rects
 */
 bool AtariExplosion::is_done( void )
 {
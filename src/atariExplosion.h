@@ -45,7 +45,7 @@ class AtariExplosion
 
     private:
         /*  The rects we'll use to draw the explosion */
-        std::vector<ARect> mExplosionRects;
+        DenseArray<ARect> mExplosionRects;
 
         /*  Pointer to the color we're drawing the rects with */
         SDL_Color *mColor;
@@ -15,12 +15,11 @@
 --------------------------------------------------------------------------------
                                   DRAW BORDER
 --------------------------------------------------------------------------------
- *  Draw the border, man.  Draw it.
+ *  Draw the border, man.  Draw it.  In the given color.
 */
-void draw_border( void )
+void draw_border( SDL_Color *c )
 {
     /*  Set the color */
-    SDL_Color *c = player.get_special_color();
     SDL_SetRenderDrawColor( gRenderer, c->r, c->g, c->b, c->a );
 
     /*  Init rect */
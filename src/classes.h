@@ -9,10 +9,34 @@
 #define CLASSES_H
 
 
+#ifndef CLASS_RANDOM_H                  //  Random class
+#include "random.h"
+#endif
+
+#ifndef CLASS_DENSE_ARRAY_H             //  DenseArray class template
+#include "densearray.h"
+#endif
+
+#ifndef CLASS_SPRITE_SHEET_H            //  SpriteSheet class
+#include "spritesheet.h"
+#endif
+
 #ifndef CLASS_TEXTURE_H                 //  Texture class
 #include "texture.h"
 #endif
 
+#ifndef CLASS_GLYPH_ATLAS_H             //  GlyphAtlas class
+#include "glyphatlas.h"
+#endif
+
+#ifndef CLASS_SPRITE_BATCH_H            //  SpriteBatch class
+#include "spritebatch.h"
+#endif
+
+#ifndef CLASS_DEBRIS_H                  //  Debris pool class
+#include "debris.h"
+#endif
+
 #ifndef CLASS_SHIP_H                    //  Ship class
 #include "ship.h"
 #endif
@@ -21,8 +45,12 @@
 #include "player.h"
 #endif
 
-#ifndef CLASS_ENEMY_H                   //  Enemy class
-#include "enemy.h"
+#ifndef CLASS_ASTEROIDS_H               //  Asteroids class
+#include "asteroids.h"
+#endif
+
+#ifndef CLASS_ASTEROID_GRID_H           //  AsteroidGrid class
+#include "asteroidgrid.h"
 #endif
 
 #ifndef CLASS_PANEL_H                   //  Panel class
@@ -65,4 +93,20 @@
 #include "kisskill.h"
 #endif
 
+#ifndef CLASS_JOBS_H                    //  Job pool class
+#include "jobs.h"
+#endif
+
+#ifndef CLASS_SNAPSHOT_H                //  World snapshot classes
+#include "snapshot.h"
+#endif
+
+#ifndef CLASS_PACER_H                   //  Frame pacer class
+#include "pacer.h"
+#endif
+
+#ifndef CLASS_PROFILER_H                //  Profiler class
+#include "profiler.h"
+#endif
+
 #endif
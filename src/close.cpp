@@ -34,25 +34,33 @@ void close( void )
     playerWhiteTexture = NULL;
     enemyTexture = NULL;
 
+    /*  ...and their sprite sheets */
+    delete playerSheet;
+    playerSheet = NULL;
+    for( int s = 1; s <= ASTEROID_SCALES; ++s )
+    {
+        delete enemySheets[ s ];
+        enemySheets[ s ] = NULL;
+    }
+
 
     /*  Get rid of text textures */
     delete gameOverText;
-    delete scoreText;
-    delete highScoreText;
     delete scoreQualifyText1;
     delete scoreQualifyText2;
     delete scoreQualifyText3;
     delete enterHighScoreText1;
     delete enterHighScoreText2;
     gameOverText = NULL;
-    scoreText = NULL;
-    highScoreText = NULL;
     scoreQualifyText1 = NULL;
     scoreQualifyText2 = NULL;
     scoreQualifyText3 = NULL;
     enterHighScoreText1 = NULL;
     enterHighScoreText2 = NULL;
 
+    /*  And the OSD, if there's one hanging around */
+    free_osd();
+
     /*  Get rid of misc textures */
     delete panelBackground;
     delete panelButtons;
@@ -85,7 +93,14 @@ void close( void )
     /*  If there are any kiss/kill structs left, get rid of them */
     kissKills.clear();
 
-    /*  Close out the fonts */
+    /*  Close out the fonts, and their glyph atlases */
+    delete gFontAtlas;
+    delete gFontSmallAtlas;
+    delete gFontTinyAtlas;
+    gFontAtlas = NULL;
+    gFontSmallAtlas = NULL;
+    gFontTinyAtlas = NULL;
+
     TTF_CloseFont( gFont );
     TTF_CloseFont( gFontSmall );
     TTF_CloseFont( gFontTiny );
@@ -127,8 +142,12 @@ void close( void )
     musicMenu = NULL;
     musicMain = NULL;
 
-    /*  Get rid of the enemies */
+    /*  Get rid of the enemies and their debris */
     enemies.clear();
+    debris.clear();
+
+    /*  Stop the worker threads */
+    jobs.stop();
 
 
     /*  Close out SDL and its subsystems */
@@ -137,3 +156,48 @@ void close( void )
     IMG_Quit();
     SDL_Quit();
 }
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                 CLOSE HEADLESS
+--------------------------------------------------------------------------------
+ *  Close out a headless run, which only ever loaded a handful of things
+*/
+void close_headless( void )
+{
+    /*  Get rid of enemy / player textures */
+    delete playerTexture;
+    delete playerWhiteTexture;
+    delete enemyTexture;
+    playerTexture = NULL;
+    playerWhiteTexture = NULL;
+    enemyTexture = NULL;
+
+    /*  ...and their sprite sheets */
+    delete playerSheet;
+    playerSheet = NULL;
+    for( int s = 1; s <= ASTEROID_SCALES; ++s )
+    {
+        delete enemySheets[ s ];
+        enemySheets[ s ] = NULL;
+    }
+
+    /*  Get rid of the star field */
+    delete starfield;
+    starfield = NULL;
+
+    /*  Get rid of the enemies and anything else left lying around */
+    enemies.clear();
+    debris.clear();
+    aExplosions.clear();
+    kissKills.clear();
+
+    /*  Stop the worker threads */
+    jobs.stop();
+
+    /*  Close out SDL_image and SDL */
+    IMG_Quit();
+    SDL_Quit();
+}
@@ -91,53 +91,197 @@ bool check_collision_box( SDL_Rect &rectA, SDL_Rect &rectB )
 --------------------------------------------------------------------------------
                               COLLISION COLLIDERS
 --------------------------------------------------------------------------------
- *  Check for collisions between two vectors of colliders.  This is used for
- *  per-pixel collision detection.
+ *  Check for collisions between two sets of colliders, the first with its top
+ *  left corner at (xA, yA) and the second at (xB, yB).  Colliders are one per
+ *  row, straight out of a sprite sheet, so only rows at the same height on
+ *  screen can touch; we walk the rows the two have in common side by side and
+ *  check each pair of spans.  Nothing gets copied or moved.
 */
 bool check_collision_colliders( std::vector<Collider> &collidersA,
-        std::vector<Collider> &collidersB )
+        int xA, int yA, std::vector<Collider> &collidersB, int xB, int yB )
 {
-    /*  These rects will be used for each opposing collider rect */
-    SDL_Rect aRect, bRect;
+    /*  The rows the two have in common */
+    int top = ( yA > yB ) ? yA : yB;
+    int bottomA = yA + (int)collidersA.size();
+    int bottomB = yB + (int)collidersB.size();
+    int bottom = ( bottomA < bottomB ) ? bottomA : bottomB;
 
-
-    /*  Loop for the first set of colliders */
-    for( unsigned int a = 0; a < collidersA.size(); ++a )
+    for( int y = top; y < bottom; ++y )
     {
-        /*
-         *  We skip back to the top of the loop if there's nothing in this part
-         *  of the collider to collide with
-         */
-        if( collidersA[ a ].w < 1 )
+        Collider &a = collidersA[ y - yA ];
+        Collider &b = collidersB[ y - yB ];
+
+        /*  If either has nothing on this row, there's nothing to hit */
+        if( a.w < 1 || b.w < 1 )
             continue;
 
-        /*  Fill in the rect for the player */
-        aRect.x = collidersA[ a ].x;
-        aRect.y = collidersA[ a ].y;
-        aRect.w = collidersA[ a ].w;
-        aRect.h = collidersA[ a ].h;
+        /*  Same test as check_collision_box(), but only across */
+        int leftA = xA + a.x;
+        int leftB = xB + b.x;
+        if( leftA < leftB + b.w && leftB < leftA + a.w )
+            return( true );
+    }
+
+    /*  If no collider collision was detected */
+    return( false );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                 GET MASK BITS
+--------------------------------------------------------------------------------
+ *  The 64 pixels of a mask row starting at pixel 'start', as one word laid
+ *  out like the mask's own.  Anything off either end of the row is clear.
+*/
+static inline Uint64 get_mask_bits( const Uint64 *row, int words, int start )
+{
+    if( start <= -64 || start >= words * 64 )
+        return( 0 );
+
+    /*  The word 'start' falls in (-1 for just off the left end) */
+    int word = ( start >= 0 ) ? start / 64 : -1;
+    int shift = start - ( word * 64 );
+
+    Uint64 bits = 0;
+    if( word >= 0 )
+        bits = row[ word ] >> shift;
+    if( shift > 0 && word + 1 < words )
+        bits |= row[ word + 1 ] << ( 64 - shift );
+
+    return( bits );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                COLLISION MASKS
+--------------------------------------------------------------------------------
+ *  Checks for collisions between two pixel masks, the first with its top left
+ *  corner at (xA, yA) and the second at (xB, yB).  Only the rows the two have
+ *  in common get looked at; for each one, B's row is shifted to line up with
+ *  A's and the two are ANDed together a word at a time.  Any bit left over is
+ *  a pixel they both cover.
+ *
+ *  Sprites here are at most a couple of words across, so plain 64-bit words
+ *  are about as wide as it's worth going.
+*/
+bool check_collision_masks( PixelMask &maskA, int xA, int yA,
+        PixelMask &maskB, int xB, int yB )
+{
+    /*  The area the two masks have in common */
+    int top = ( yA > yB ) ? yA : yB;
+    int bottom = ( yA + maskA.h < yB + maskB.h ) ?
+        yA + maskA.h : yB + maskB.h;
+    int left = ( xA > xB ) ? xA : xB;
+    int right = ( xA + maskA.w < xB + maskB.w ) ?
+        xA + maskA.w : xB + maskB.w;
+
+    /*  If they don't overlap at all, no collision */
+    if( top >= bottom || left >= right )
+        return( false );
+
+    /*  The words of A's rows that are in the overlap */
+    int firstWord = ( left - xA ) / 64;
+    int lastWord = ( right - xA - 1 ) / 64;
+
+    /*  How far B is to the right of A */
+    int dx = xB - xA;
+
+    for( int y = top; y < bottom; ++y )
+    {
+        const Uint64 *rowA = &maskA.bits[ ( y - yA ) * maskA.words ];
+        const Uint64 *rowB = &maskB.bits[ ( y - yB ) * maskB.words ];
+
+        for( int k = firstWord; k <= lastWord; ++k )
+        {
+            if( rowA[ k ] &
+                    get_mask_bits( rowB, maskB.words, ( k * 64 ) - dx ) )
+                return( true );
+        }
+    }
+
+    /*  If no pixels overlapped */
+    return( false );
+}
+
 
 
-        /*  Loop for the second set of colliders */
-        for( unsigned int b = 0; b < collidersB.size(); ++b )
+/*
+--------------------------------------------------------------------------------
+                             COLLISION MASK SWEEP
+--------------------------------------------------------------------------------
+ *  Checks whether mask B, moving straight from (xB, yFrom) to (xB, yTo),
+ *  touches mask A at (xA, yA) anywhere along the way.  At warp speed an
+ *  asteroid can move further in a tick than the ship is tall, so checking
+ *  where it ends up isn't enough.
+ *
+ *  Over the move, a row of A can meet any of the rows of B that pass through
+ *  its height.  Those get ORed together (lined up with A the same way
+ *  check_collision_masks() does it) and ANDed with A's row.
+*/
+bool check_collision_mask_sweep( PixelMask &maskA, int xA, int yA,
+        PixelMask &maskB, int xB, int yFrom, int yTo )
+{
+    /*  Not moving is just the ordinary check */
+    if( yFrom == yTo )
+        return( check_collision_masks( maskA, xA, yA, maskB, xB, yTo ) );
+
+    /*  Top of B at the start and the end of its move, in order */
+    int high = ( yFrom < yTo ) ? yFrom : yTo;
+    int low = ( yFrom < yTo ) ? yTo : yFrom;
+
+    /*  The area the two have in common over the whole move */
+    int top = ( yA > high ) ? yA : high;
+    int bottom = ( yA + maskA.h < low + maskB.h ) ?
+        yA + maskA.h : low + maskB.h;
+    int left = ( xA > xB ) ? xA : xB;
+    int right = ( xA + maskA.w < xB + maskB.w ) ?
+        xA + maskA.w : xB + maskB.w;
+
+    /*  If they never overlap at all, no collision */
+    if( top >= bottom || left >= right )
+        return( false );
+
+    /*  The words of A's rows that are in the overlap */
+    int firstWord = ( left - xA ) / 64;
+    int lastWord = ( right - xA - 1 ) / 64;
+
+    /*  How far B is to the right of A */
+    int dx = xB - xA;
+
+    for( int y = top; y < bottom; ++y )
+    {
+        const Uint64 *rowA = &maskA.bits[ ( y - yA ) * maskA.words ];
+
+        /*  The rows of B that pass through this height */
+        int first = y - low;
+        int last = y - high;
+        if( first < 0 )
+            first = 0;
+        if( last > maskB.h - 1 )
+            last = maskB.h - 1;
+
+        for( int k = firstWord; k <= lastWord; ++k )
         {
-            /*  If nothing to collide with, skip back to the top of the loop */
-            if( collidersB[ b ].w < 1 )
+            if( rowA[ k ] == 0 )
                 continue;
 
-            /*  Fill in the rect for the enemy */
-            bRect.x = collidersB[ b ].x;
-            bRect.y = collidersB[ b ].y;
-            bRect.w = collidersB[ b ].w;
-            bRect.h = collidersB[ b ].h;
+            Uint64 swept = 0;
+            for( int r = first; r <= last; ++r )
+            {
+                swept |= get_mask_bits( &maskB.bits[ r * maskB.words ],
+                        maskB.words, ( k * 64 ) - dx );
+            }
 
-            /*  Check collision */
-            if( check_collision_box( aRect, bRect ) )
+            if( rowA[ k ] & swept )
                 return( true );
         }
     }
 
-    /*  If no collider collision was detected */
+    /*  If no pixels overlapped anywhere along the way */
     return( false );
 }
 
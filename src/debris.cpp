@@ -0,0 +1,359 @@
+/*******************************************************************************
+ *  debris.cpp
+ *
+ *  This file defines the debris pool class, which holds the particles left
+ *  over when the player or an asteroid explodes.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*  Batches of points, shared by every pool */
+std::vector<SDL_Point> DebrisPool::mBatches[ TOTAL_COLORS ]
+    [ DEBRIS_ALPHA_LEVELS ];
+
+
+/*
+--------------------------------------------------------------------------------
+                                  CONSTRUCTOR
+--------------------------------------------------------------------------------
+*/
+DebrisPool::DebrisPool( void )
+{
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                     CLEAR
+--------------------------------------------------------------------------------
+ *  Every cloud goes back on the free list; the slots themselves stay around
+ *  for the next game
+*/
+void DebrisPool::clear( void )
+{
+    mFree.clear();
+    for( int c = (int)mStates.size() - 1; c >= 0; --c )
+    {
+        mStates[ c ] = CLOUD_FREE;
+        mFree.push_back( c );
+    }
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      ADD
+--------------------------------------------------------------------------------
+ *  Scatter a cloud of particles out from the middle of the given rect, in a
+ *  free slot (making one if need be).  Returns the cloud.
+*/
+int DebrisPool::add( int x, int y, int w, int h )
+{
+    int cloud;
+    if( ! mFree.empty() )
+    {
+        cloud = mFree.back();
+        mFree.pop_back();
+    }
+    else
+    {
+        cloud = (int)mStates.size();
+
+        mRngs.push_back( Random() );
+        mCounts.push_back( 0 );
+        mStates.push_back( CLOUD_FREE );
+
+        int size = ( cloud + 1 ) * DEBRIS_CLOUD_PARTICLES;
+        mX.resize( size );
+        mY.resize( size );
+        mVelocityX.resize( size );
+        mVelocityY.resize( size );
+        mAlpha.resize( size );
+        mColor.resize( size );
+        mTwinkle.resize( size );
+    }
+
+    /*  Random numbers come from the effects stream */
+    Random &r = rng[ RNG_EFFECTS ];
+
+    /*  Seed the cloud's stream for update_cloud() */
+    Uint64 seed = r.next();
+    mRngs[ cloud ].seed( ( seed << 32 ) | r.next() );
+
+    /*  The number of particles to draw -- min 20, max 99 */
+    int count = r.range( 80 ) + 20;
+    mCounts[ cloud ] = count;
+    mStates[ cloud ] = CLOUD_ACTIVE;
+
+    /*  For each type of debris, that type's particles one after another */
+    int k = cloud * DEBRIS_CLOUD_PARTICLES;
+    for( int c = 0; c < TOTAL_DEBRIS; ++c )
+    {
+        for( int p = 0; p < count; ++p, ++k )
+        {
+            /*  Starting positions */
+            mX[ k ] = ( x + ( w / 2 ) +
+                ( ( r.range( 10 ) + 1 ) * r.sign() ) );
+            mY[ k ] = ( y + ( h / 2 ) +
+                ( ( r.range( 10 ) + 1 ) * r.sign() ) );
+
+            /*  Random velocity and direction */
+            int velocityX = r.range( 5 ) + 1;
+            int velocityY = r.range( 5 ) + 1;
+            mVelocityX[ k ] = (Sint8)( velocityX * r.sign() );
+            mVelocityY[ k ] = (Sint8)( velocityY * r.sign() );
+
+            /*  Whether or not this particle 'twinkles' */
+            mTwinkle[ k ] = r.chance( 2 );
+
+            /*  Color is set according to current index in the upper for loop */
+            switch( c )
+            {
+                case DEBRIS_WHITE:
+                    mColor[ k ] = COLOR_WHITE;
+                    break;
+                case DEBRIS_YELLOW:
+                    mColor[ k ] = COLOR_YELLOW;
+                    break;
+                case DEBRIS_ORANGE:
+                    mColor[ k ] = COLOR_ORANGE;
+                    break;
+                default:
+                    mColor[ k ] = r.range( TOTAL_COLORS );
+                    break;
+            }
+            mAlpha[ k ] = colors[ mColor[ k ] ].a;
+        }
+    }
+
+    return( cloud );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   FREE CLOUD
+--------------------------------------------------------------------------------
+*/
+void DebrisPool::free_cloud( int cloud )
+{
+    if( mStates[ cloud ] == CLOUD_FREE )
+        return;
+
+    mStates[ cloud ] = CLOUD_FREE;
+    mFree.push_back( cloud );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   CLOUD INFO
+--------------------------------------------------------------------------------
+*/
+bool DebrisPool::is_done( int cloud )
+{
+    return( mStates[ cloud ] == CLOUD_DONE );
+}
+
+int DebrisPool::get_cloud_count( void )
+{
+    return( (int)mStates.size() );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                  COPY ACTIVE
+--------------------------------------------------------------------------------
+ *  For the world snapshots.  Copying the whole pool meant copying every slot
+ *  the game had ever needed, faded out or not; this copies only the particles
+ *  rendering looks at, and only for the clouds that are still going, into
+ *  slots 0, 1, 2...  The particle arrays only ever grow, so once things have
+ *  settled in this doesn't allocate.
+*/
+template <class T>
+static void copy_particles( const std::vector<T> &from, std::vector<T> &to,
+        int fromK, int toK, int count )
+{
+    std::copy( from.begin() + fromK, from.begin() + fromK + count,
+            to.begin() + toK );
+}
+
+void DebrisPool::copy_active( const DebrisPool &pool )
+{
+    mRngs.clear();
+    mCounts.clear();
+    mStates.clear();
+    mFree.clear();
+
+    for( int c = 0; c < (int)pool.mStates.size(); ++c )
+    {
+        if( pool.mStates[ c ] != CLOUD_ACTIVE )
+            continue;
+
+        int cloud = (int)mStates.size();
+        mCounts.push_back( pool.mCounts[ c ] );
+        mStates.push_back( CLOUD_ACTIVE );
+
+        int size = ( cloud + 1 ) * DEBRIS_CLOUD_PARTICLES;
+        if( (int)mX.size() < size )
+        {
+            mX.resize( size );
+            mY.resize( size );
+            mVelocityX.resize( size );
+            mVelocityY.resize( size );
+            mAlpha.resize( size );
+            mColor.resize( size );
+        }
+
+        int from = c * DEBRIS_CLOUD_PARTICLES;
+        int to = cloud * DEBRIS_CLOUD_PARTICLES;
+        int count = TOTAL_DEBRIS * pool.mCounts[ c ];
+
+        copy_particles( pool.mX, mX, from, to, count );
+        copy_particles( pool.mY, mY, from, to, count );
+        copy_particles( pool.mVelocityX, mVelocityX, from, to, count );
+        copy_particles( pool.mVelocityY, mVelocityY, from, to, count );
+        copy_particles( pool.mAlpha, mAlpha, from, to, count );
+        copy_particles( pool.mColor, mColor, from, to, count );
+    }
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                     UPDATE
+--------------------------------------------------------------------------------
+ *  Nothing outside of clouds [begin, end) gets touched, so different ranges
+ *  can be updated at the same time.
+*/
+void DebrisPool::update( int begin, int end )
+{
+    for( int c = begin; c < end; ++c )
+    {
+        if( mStates[ c ] == CLOUD_ACTIVE && update_cloud( c ) )
+            mStates[ c ] = CLOUD_DONE;
+    }
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                  UPDATE CLOUD
+--------------------------------------------------------------------------------
+ *  Moves and fades the cloud's particles by one tick.  Returns true once every
+ *  one of them has faded out.
+*/
+bool DebrisPool::update_cloud( int cloud )
+{
+    Random &r = mRngs[ cloud ];
+
+    int begin = cloud * DEBRIS_CLOUD_PARTICLES;
+    int end = begin + ( TOTAL_DEBRIS * mCounts[ cloud ] );
+
+    /*  Counter to determine if we're done updating explosion particles */
+    int done = 0;
+
+    for( int k = begin; k < end; ++k )
+    {
+        /*  Move the debris along the X and Y axes */
+        mX[ k ] += mVelocityX[ k ];
+        mY[ k ] += mVelocityY[ k ];
+
+        /*
+         *  We're using a separate integer for the alpha value because
+         *  the Uint8s behave strangely when decreased to below zero; this
+         *  is easier to work with.
+         */
+        int alpha = mAlpha[ k ];            //  Set to alpha value
+        alpha -= r.range( 3 ) + 4;          //  Decrease alpha
+
+        /*  If the alpha falls to zero or less, set it to zero */
+        if( alpha <= 0 )
+        {
+            ++done;         //  We're done with this particle
+            alpha = 0;
+        }
+
+        /*  Twinkle */
+        if( mTwinkle[ k ] )
+        {
+            /*  1 in 64 chance of twinkling */
+            if( r.chance( 64 ) )
+            {
+                if( alpha > 0 && alpha < 127 )
+                    alpha += 127;
+            }
+        }
+
+        /*  Set alpha value */
+        mAlpha[ k ] = alpha;
+    }
+
+    /*  Check to see if we're all done */
+    return( done == end - begin );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                     RENDER
+--------------------------------------------------------------------------------
+ *  Sort the visible particles into batches by color and alpha level, then
+ *  draw each batch in one go.  Each particle is drawn backed off by however
+ *  much of the current tick's movement hasn't 'happened' yet.
+*/
+void DebrisPool::render( void )
+{
+    /*  The fraction of a tick's movement still ahead of us */
+    float behind = 1.0f - tickInterpolation;
+
+    for( int c = 0; c < (int)mStates.size(); ++c )
+    {
+        if( mStates[ c ] != CLOUD_ACTIVE )
+            continue;
+
+        int begin = c * DEBRIS_CLOUD_PARTICLES;
+        int end = begin + ( TOTAL_DEBRIS * mCounts[ c ] );
+
+        for( int k = begin; k < end; ++k )
+        {
+            /*  Faded out all the way */
+            if( mAlpha[ k ] == 0 )
+                continue;
+
+            int level = mAlpha[ k ] * DEBRIS_ALPHA_LEVELS / 256;
+
+            SDL_Point point;
+            point.x = mX[ k ] - (int)( behind * mVelocityX[ k ] );
+            point.y = mY[ k ] - (int)( behind * mVelocityY[ k ] );
+
+            mBatches[ mColor[ k ] ][ level ].push_back( point );
+        }
+    }
+
+    /*  Draw the batches, and empty them out (keeping their memory) */
+    for( int color = 0; color < TOTAL_COLORS; ++color )
+    {
+        for( int level = 0; level < DEBRIS_ALPHA_LEVELS; ++level )
+        {
+            std::vector<SDL_Point> &batch = mBatches[ color ][ level ];
+            if( batch.empty() )
+                continue;
+
+            /*
+             *  The top of the level's range, so full alpha stays full and
+             *  the faintest particles (alpha 1 to 15) still show
+             */
+            SDL_SetRenderDrawColor( gRenderer, colors[ color ].r,
+                    colors[ color ].g, colors[ color ].b,
+                    ( ( level + 1 ) * 256 / DEBRIS_ALPHA_LEVELS ) - 1 );
+
+            SDL_RenderDrawPoints( gRenderer, &batch[ 0 ], (int)batch.size() );
+            batch.clear();
+        }
+    }
+}
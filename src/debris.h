@@ -0,0 +1,113 @@
+/*******************************************************************************
+ *  debris.h
+ *
+ *  This is the header file for the debris pool class, defined in debris.cpp,
+ *  which holds the clouds of particles ships (the player or asteroids) turn
+ *  into when they blow up.
+ *
+*******************************************************************************/
+#ifndef CLASS_DEBRIS_H
+#define CLASS_DEBRIS_H
+
+
+enum debrisEnum
+{
+    DEBRIS_WHITE,
+    DEBRIS_COLOR,
+    DEBRIS_YELLOW,
+    DEBRIS_ORANGE,
+    TOTAL_DEBRIS
+};
+
+/*  Most particles of each kind of debris */
+#define DEBRIS_MAX_PARTICLES 100
+
+/*  Room each cloud takes up in the pool */
+#define DEBRIS_CLOUD_PARTICLES ( TOTAL_DEBRIS * DEBRIS_MAX_PARTICLES )
+
+/*  Particles are drawn in batches by color and this many levels of alpha */
+#define DEBRIS_ALPHA_LEVELS 16
+
+/*  States of a cloud */
+enum debrisCloudStates
+{
+    CLOUD_FREE,                 //  Slot isn't being used
+    CLOUD_ACTIVE,               //  Particles are still flying around
+    CLOUD_DONE                  //  Every particle has faded out
+};
+
+
+/*
+ *  The DebrisPool class
+ *
+ *  Every explosion's particles live here, one structure of arrays for the
+ *  whole game rather than a few hundred particle structs per ship.  Each cloud
+ *  (explosion) has a fixed slot of DEBRIS_CLOUD_PARTICLES; slots are handed
+ *  out from a free list and never given back to the heap.
+ *
+ *  The simulation moves the particles in the update phase, each cloud with
+ *  random numbers of its own, so clouds can be updated in any order or on any
+ *  thread.  Drawing collects every visible particle into one batch per color
+ *  and alpha level, so there's a draw call per batch instead of per particle.
+ */
+class DebrisPool
+{
+    public:
+        /*  Constructor */
+        DebrisPool( void );
+
+        /*  Free every cloud */
+        void clear( void );
+
+        /*  Blow up whatever's in the given rect; returns the new cloud */
+        int add( int x, int y, int w, int h );
+
+        /*  Give a cloud's slot back */
+        void free_cloud( int cloud );
+
+        /*  Has every particle in the cloud faded out? */
+        bool is_done( int cloud );
+
+        /*  Number of cloud slots, in use or not */
+        int get_cloud_count( void );
+
+        /*
+         *  Become a copy of just the clouds in the given pool that are still
+         *  going, packed together.  The copy is only good for drawing.
+         */
+        void copy_active( const DebrisPool &pool );
+
+        /*  Move and fade clouds [begin, end) by a tick */
+        void update( int begin, int end );
+
+        /*  Draw every cloud that's still going */
+        void render( void );
+
+    private:
+        /*  Move and fade one cloud; returns true once it's all faded out */
+        bool update_cloud( int cloud );
+
+        /*  Per cloud */
+        std::vector<Random> mRngs;          //  The cloud's own random numbers
+        std::vector<int> mCounts;           //  Particles of each kind
+        std::vector<Uint8> mStates;         //  CLOUD_*
+        std::vector<int> mFree;             //  Free slots
+
+        /*  Per particle, DEBRIS_CLOUD_PARTICLES per cloud */
+        std::vector<int> mX;
+        std::vector<int> mY;
+        std::vector<Sint8> mVelocityX;      //  Direction included
+        std::vector<Sint8> mVelocityY;
+        std::vector<Uint8> mAlpha;
+        std::vector<Uint8> mColor;          //  COLOR_*
+        std::vector<Uint8> mTwinkle;
+
+        /*
+         *  Batches of points, by color and alpha level.  Only the rendering
+         *  side ever touches them.
+         */
+        static std::vector<SDL_Point> mBatches[ TOTAL_COLORS ]
+            [ DEBRIS_ALPHA_LEVELS ];
+};
+
+#endif
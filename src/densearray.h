@@ -0,0 +1,128 @@
+/*******************************************************************************
+ *  densearray.h
+ *
+ *  This is the header file for the DenseArray class template, a packed array
+ *  of game objects that can have any number of them removed in time linear in
+ *  the number removed.
+ *
+*******************************************************************************/
+#ifndef CLASS_DENSE_ARRAY_H
+#define CLASS_DENSE_ARRAY_H
+
+/*
+ *  The DenseArray class
+ *
+ *  Removal is deferred:  remove() only notes the index, and nothing moves
+ *  until compact(), which fills each hole with whatever is at the end of the
+ *  array ('swap and pop').  That means the order of the items changes, so
+ *  this is only for things where order doesn't matter.  Indices stay good
+ *  until compact() is called, so it's safe to remove() while looping over
+ *  the items.
+ *
+ *  Several arrays that hold the fields of the same objects (see Asteroids)
+ *  can be compacted in step by handing each of them the same removal list.
+ */
+template <class T>
+class DenseArray
+{
+    public:
+        /*  Add an item to the end */
+        void push_back( const T &item )
+        {
+            mItems.push_back( item );
+        }
+
+        /*  Get at an item */
+        T& operator[]( size_t i )
+        {
+            return( mItems[ i ] );
+        }
+
+        const T& operator[]( size_t i ) const
+        {
+            return( mItems[ i ] );
+        }
+
+        T& back( void )
+        {
+            return( mItems.back() );
+        }
+
+        /*  Number of items, including any waiting to be removed */
+        size_t size( void ) const
+        {
+            return( mItems.size() );
+        }
+
+        bool empty( void ) const
+        {
+            return( mItems.empty() );
+        }
+
+        /*  Room for this many items without reallocating */
+        void reserve( size_t count )
+        {
+            mItems.reserve( count );
+        }
+
+        /*  Get rid of everything, including any pending removals */
+        void clear( void )
+        {
+            mItems.clear();
+            mRemoved.clear();
+        }
+
+        /*  Mark an item to be removed by the next compact() */
+        void remove( size_t i )
+        {
+            mRemoved.push_back( i );
+        }
+
+        /*  Remove everything marked with remove() */
+        void compact( void )
+        {
+            compact( mRemoved );
+            mRemoved.clear();
+        }
+
+        /*
+         *  Remove the items at the given indices, each at most once.  Working
+         *  from the highest index down means the item moved into a hole is
+         *  never one that's still waiting to be removed.  The indices are
+         *  normally noted in a forward pass and so are already in order;
+         *  they only get sorted if they aren't.
+         */
+        void compact( std::vector<size_t> &removed )
+        {
+            for( size_t i = 1; i < removed.size(); ++i )
+            {
+                if( removed[ i ] < removed[ i - 1 ] )
+                {
+                    std::sort( removed.begin(), removed.end() );
+                    break;
+                }
+            }
+
+            for( size_t r = removed.size(); r > 0; --r )
+            {
+                size_t i = removed[ r - 1 ];
+
+                /*  Already gone */
+                if( r < removed.size() && removed[ r ] == i )
+                    continue;
+
+                if( i != mItems.size() - 1 )
+                    mItems[ i ] = mItems.back();
+                mItems.pop_back();
+            }
+        }
+
+    private:
+        /*  The items themselves */
+        std::vector<T> mItems;
+
+        /*  Indices of the items to get rid of on the next compact() */
+        std::vector<size_t> mRemoved;
+};
+
+#endif
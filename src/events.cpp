@@ -144,20 +144,25 @@ void switch_letter( int direction )
 */
 void events_main( SDL_Event &e )
 {
-    /*  Send all mouse motion events straight to the player class */
+    /*
+     *  Gameplay input is only noted here; it gets handed to the player at the
+     *  start of the next tick (see get_tick_input() in replay.cpp)
+     */
+
+    /*  Mouse motion moves the ship to the mouse */
     if( e.type == SDL_MOUSEMOTION )
-        player.move_mouse();
+        pendingButtons |= INPUT_MOUSE_MOVED;
 
     /*  Mouse button events are less complex and can be handled here */
     if( e.type == SDL_MOUSEBUTTONUP )
     {
         /*  Left click:  Honk horn */
         if( e.button.button == SDL_BUTTON_LEFT )
-            player.honk();
+            pendingButtons |= INPUT_HONK;
 
         /*  Right-click:  Activate power (or make an 'engine stall' sound) */
         if( e.button.button == SDL_BUTTON_RIGHT )
-            player.init_power();
+            pendingButtons |= INPUT_POWER;
 
         /*  Middle click:  Pause the game */
         if( e.button.button == SDL_BUTTON_MIDDLE )
@@ -208,12 +213,12 @@ void events_main( SDL_Event &e )
 
             /*  SPACE honks the horn */
             case SDLK_SPACE:
-                player.honk();
+                pendingButtons |= INPUT_HONK;
                 break;
 
             /*  SHIFT activates (or attempt to activate) the power */
             case SDLK_LSHIFT:
-                player.init_power();
+                pendingButtons |= INPUT_POWER;
                 break;
         }
     }
@@ -616,6 +621,12 @@ void handle_events( SDL_Event &e )
                 else
                     SDL_SetRelativeMouseMode( SDL_TRUE );
             }
+
+#ifdef PROFILING
+            /*  F3 shows / hides the profiler overlay */
+            if( e.key.keysym.sym == SDLK_F3 )
+                profiler.toggle_overlay();
+#endif
         }
 
 
@@ -633,8 +644,4 @@ void handle_events( SDL_Event &e )
         else if( currentScreen == SCREEN_HELP || currentScreen ==SCREEN_CREDITS)
             events_help_credits( e );
     }
-
-    /*  This is outside the poll event loop to prevent keyboard delays */
-    player.move_keyboard();
-
 }
@@ -118,6 +118,21 @@ bool init_game_over_textures( void )
 */
 void game_over( void )
 {
+    /*  The simulation thread leaves this to the main thread */
+    if( defer_game_over() )
+        return;
+
+    /*  A recording (or replay) covers a single game */
+    if( replayMode != REPLAY_OFF )
+        stop_replay();
+
+    /*  Headless runs just tally the score and start another game */
+    if( headless )
+    {
+        headless_game_over();
+        return;
+    }
+
     /*  Init all of the things */
     if( ! init_game_over_textures() )
     {
@@ -129,7 +144,7 @@ void game_over( void )
         Mix_HaltMusic();
 
     /*  Disable the screen flash */
-    screenFlash = false;
+    skip_screen_flash();
 
     /*  Do the transition */
     start_transition( SCREEN_GAME_OVER, DIRECTION_UP );
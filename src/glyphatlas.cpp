@@ -0,0 +1,301 @@
+/*******************************************************************************
+ *  glyphatlas.cpp
+ *
+ *  This file defines the GlyphAtlas class, which draws text from a texture of
+ *  pre-rendered glyphs instead of rendering a new texture for every string.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*
+--------------------------------------------------------------------------------
+                                  CONSTRUCTOR
+--------------------------------------------------------------------------------
+*/
+GlyphAtlas::GlyphAtlas( void )
+{
+    mTexture = NULL;
+    mWidth = mHeight = 0;
+    mLineHeight = 0;
+
+    for( int g = 0; g < GLYPH_COUNT; ++g )
+    {
+        mClips[ g ].x = mClips[ g ].y = mClips[ g ].w = mClips[ g ].h = 0;
+        mAdvances[ g ] = 0;
+    }
+
+    memset( mKerning, 0, sizeof( mKerning ) );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   DESTRUCTOR
+--------------------------------------------------------------------------------
+*/
+GlyphAtlas::~GlyphAtlas( void )
+{
+    free_atlas();
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   FREE ATLAS
+--------------------------------------------------------------------------------
+*/
+void GlyphAtlas::free_atlas( void )
+{
+    if( mTexture != NULL )
+    {
+        SDL_DestroyTexture( mTexture );
+        mTexture = NULL;
+    }
+
+    mWidth = mHeight = 0;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      INIT
+--------------------------------------------------------------------------------
+ *  Render every glyph in white, lay them out in a grid of equal cells and
+ *  upload the lot as one texture.  Each glyph is rendered the same way
+ *  TTF_RenderText_Blended() would, and kerned the same way (if the font has
+ *  kerning turned on), so strings come out looking the same as they did as
+ *  textures of their own.
+*/
+bool GlyphAtlas::init( TTF_Font *font )
+{
+    free_atlas();
+
+    SDL_Color white = { 255, 255, 255, 255 };
+    SDL_Surface *glyphs[ GLYPH_COUNT ];
+
+    mLineHeight = TTF_FontHeight( font );
+
+    /*  Render each glyph, and find out how big the cells need to be */
+    int cellW = 1;
+    int cellH = mLineHeight;
+    for( int g = 0; g < GLYPH_COUNT; ++g )
+    {
+        Uint16 c = (Uint16)( GLYPH_FIRST + g );
+
+        int minX, maxX, minY, maxY, advance;
+        if( TTF_GlyphMetrics( font, c, &minX, &maxX, &minY, &maxY,
+                    &advance ) != 0 )
+            advance = 0;
+        mAdvances[ g ] = advance;
+
+        glyphs[ g ] = TTF_RenderGlyph_Blended( font, c, white );
+        if( glyphs[ g ] == NULL )
+            continue;
+
+        if( glyphs[ g ]->w > cellW )
+            cellW = glyphs[ g ]->w;
+        if( glyphs[ g ]->h > cellH )
+            cellH = glyphs[ g ]->h;
+    }
+
+    /*  Kerning for every pair, which is mostly zeros */
+    bool kerning = TTF_GetFontKerning( font ) != 0;
+    for( int first = 0; first < GLYPH_COUNT; ++first )
+    {
+        for( int second = 0; second < GLYPH_COUNT; ++second )
+        {
+            int kern = 0;
+            if( kerning )
+                kern = TTF_GetFontKerningSizeGlyphs( font,
+                        (Uint16)( GLYPH_FIRST + first ),
+                        (Uint16)( GLYPH_FIRST + second ) );
+            mKerning[ first ][ second ] = (Sint8)kern;
+        }
+    }
+
+    int rows = ( GLYPH_COUNT + GLYPH_ATLAS_COLUMNS - 1 ) / GLYPH_ATLAS_COLUMNS;
+    SDL_Surface *atlas = SDL_CreateRGBSurfaceWithFormat( 0,
+            cellW * GLYPH_ATLAS_COLUMNS, cellH * rows, 32,
+            SDL_PIXELFORMAT_RGBA32 );
+    if( atlas == NULL )
+    {
+        printf("ERROR:  Could not create glyph atlas.  SDL Error:  %s\n",
+                SDL_GetError() );
+        for( int g = 0; g < GLYPH_COUNT; ++g )
+            SDL_FreeSurface( glyphs[ g ] );
+        return( false );
+    }
+
+    /*  Copy each glyph into its cell, alpha and all */
+    for( int g = 0; g < GLYPH_COUNT; ++g )
+    {
+        SDL_Rect &clip = mClips[ g ];
+        clip.x = ( g % GLYPH_ATLAS_COLUMNS ) * cellW;
+        clip.y = ( g / GLYPH_ATLAS_COLUMNS ) * cellH;
+        clip.w = clip.h = 0;
+
+        if( glyphs[ g ] == NULL )
+            continue;
+
+        clip.w = glyphs[ g ]->w;
+        clip.h = glyphs[ g ]->h;
+
+        SDL_SetSurfaceBlendMode( glyphs[ g ], SDL_BLENDMODE_NONE );
+        SDL_BlitSurface( glyphs[ g ], NULL, atlas, &clip );
+        SDL_FreeSurface( glyphs[ g ] );
+    }
+
+    mTexture = SDL_CreateTextureFromSurface( gRenderer, atlas );
+    mWidth = atlas->w;
+    mHeight = atlas->h;
+    SDL_FreeSurface( atlas );
+
+    if( mTexture == NULL )
+    {
+        printf("ERROR:  Cannot create glyph atlas texture.  SDL Error:  %s\n",
+                SDL_GetError() );
+        mWidth = mHeight = 0;
+        return( false );
+    }
+    SDL_SetTextureBlendMode( mTexture, SDL_BLENDMODE_BLEND );
+
+    return( true );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   GET GLYPH
+--------------------------------------------------------------------------------
+*/
+int GlyphAtlas::get_glyph( char c )
+{
+    int g = (unsigned char)c - GLYPH_FIRST;
+    if( g < 0 || g >= GLYPH_COUNT )
+        g = '?' - GLYPH_FIRST;
+
+    return( g );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                  GET ADVANCE
+--------------------------------------------------------------------------------
+ *  The glyph's own advance, plus the kerning between it and the character
+ *  after it (if there is one)
+*/
+int GlyphAtlas::get_advance( int g, char next )
+{
+    if( next == '\0' )
+        return( mAdvances[ g ] );
+
+    return( mAdvances[ g ] + mKerning[ g ][ get_glyph( next ) ] );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   TEXT SIZE
+--------------------------------------------------------------------------------
+*/
+int GlyphAtlas::get_text_width( const char *text )
+{
+    int width = 0;
+    for( const char *c = text; *c != '\0'; ++c )
+        width += get_advance( get_glyph( *c ), *( c + 1 ) );
+
+    return( width );
+}
+
+int GlyphAtlas::get_height( void )
+{
+    return( mLineHeight );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                     RENDER
+--------------------------------------------------------------------------------
+ *  Lay out a quad for each character, moving along by each glyph's advance
+ *  (and the kerning to the next), and draw them all in one go.  The color (and
+ *  alpha) go on the vertices, so the atlas texture itself never changes.
+*/
+void GlyphAtlas::render( const char *text, int x, int y, SDL_Color color,
+        Uint8 alpha )
+{
+    if( mTexture == NULL || alpha == 0 )
+        return;
+
+    mVertices.clear();
+    mIndices.clear();
+
+    SDL_Color tint = color;
+    tint.a = (Uint8)( ( color.a * alpha ) / 255 );
+
+    float texW = (float)mWidth;
+    float texH = (float)mHeight;
+    int pen = x;
+
+    for( const char *c = text; *c != '\0'; ++c )
+    {
+        int g = get_glyph( *c );
+        SDL_Rect &clip = mClips[ g ];
+
+        if( clip.w > 0 && clip.h > 0 )
+        {
+            int first = (int)mVertices.size();
+
+            float left = (float)pen;
+            float right = (float)( pen + clip.w );
+            float top = (float)y;
+            float bottom = (float)( y + clip.h );
+
+            float u0 = clip.x / texW;
+            float u1 = ( clip.x + clip.w ) / texW;
+            float v0 = clip.y / texH;
+            float v1 = ( clip.y + clip.h ) / texH;
+
+            SDL_Vertex corner;
+            corner.color = tint;
+
+            corner.position.x = left;
+            corner.position.y = top;
+            corner.tex_coord.x = u0;
+            corner.tex_coord.y = v0;
+            mVertices.push_back( corner );
+
+            corner.position.x = right;
+            corner.tex_coord.x = u1;
+            mVertices.push_back( corner );
+
+            corner.position.y = bottom;
+            corner.tex_coord.y = v1;
+            mVertices.push_back( corner );
+
+            corner.position.x = left;
+            corner.tex_coord.x = u0;
+            mVertices.push_back( corner );
+
+            /*  Two triangles per quad */
+            mIndices.push_back( first );
+            mIndices.push_back( first + 1 );
+            mIndices.push_back( first + 2 );
+            mIndices.push_back( first );
+            mIndices.push_back( first + 2 );
+            mIndices.push_back( first + 3 );
+        }
+
+        pen += get_advance( g, *( c + 1 ) );
+    }
+
+    if( mIndices.empty() )
+        return;
+
+    SDL_RenderGeometry( gRenderer, mTexture, &mVertices[ 0 ],
+            (int)mVertices.size(), &mIndices[ 0 ], (int)mIndices.size() );
+}
@@ -0,0 +1,83 @@
+/*******************************************************************************
+ *  glyphatlas.h
+ *
+ *  This is the header file for the GlyphAtlas class, defined in
+ *  glyphatlas.cpp.
+ *
+*******************************************************************************/
+#ifndef CLASS_GLYPH_ATLAS_H
+#define CLASS_GLYPH_ATLAS_H
+
+/*  The characters an atlas has (printable ASCII) */
+#define GLYPH_FIRST 32
+#define GLYPH_LAST 126
+#define GLYPH_COUNT ( GLYPH_LAST - GLYPH_FIRST + 1 )
+
+/*  Glyphs per row of the atlas texture */
+#define GLYPH_ATLAS_COLUMNS 16
+
+/*
+ *  The GlyphAtlas class
+ *
+ *  Every printable character of a font, rendered once (in white) into a
+ *  single texture.  Drawing a string is then just a matter of picking out
+ *  each character's part of the texture:  one quad per character, tinted by
+ *  the vertex colors, sent off in one SDL_RenderGeometry() call per string.
+ *  Each pair of glyphs is kerned the way TTF_RenderText_Blended() would kern
+ *  it, from a table made along with the atlas.
+ *
+ *  That's for text that changes all the time (the score, the OSD, the
+ *  kiss/kill points), which would otherwise mean rendering, uploading and
+ *  throwing away a whole texture every time it changed.
+ */
+class GlyphAtlas
+{
+    public:
+        /*  Constructor */
+        GlyphAtlas( void );
+
+        /*  Destructor */
+        ~GlyphAtlas( void );
+
+        /*  Render the font's glyphs into the atlas */
+        bool init( TTF_Font *font );
+
+        /*  Free the atlas texture */
+        void free_atlas( void );
+
+        /*  Size the given string would be drawn at */
+        int get_text_width( const char *text );
+        int get_height( void );
+
+        /*  Draw a string with its top left corner at (x, y) */
+        void render( const char *text, int x, int y, SDL_Color color,
+                Uint8 alpha = 255 );
+
+    private:
+        /*  Index of a character's glyph (unknown ones get a '?') */
+        int get_glyph( char c );
+
+        /*  How far the pen moves from one glyph to the next, kerning and all */
+        int get_advance( int g, char next );
+
+        /*  The atlas itself, and its size */
+        SDL_Texture *mTexture;
+        int mWidth;
+        int mHeight;
+
+        /*  Height of a line of text */
+        int mLineHeight;
+
+        /*  Where each glyph is in the atlas, and how far it moves the pen */
+        SDL_Rect mClips[ GLYPH_COUNT ];
+        int mAdvances[ GLYPH_COUNT ];
+
+        /*  Kerning between each pair of glyphs, [ first ][ second ] */
+        Sint8 mKerning[ GLYPH_COUNT ][ GLYPH_COUNT ];
+
+        /*  Quads for the string being drawn (kept to save reallocating) */
+        std::vector<SDL_Vertex> mVertices;
+        std::vector<int> mIndices;
+};
+
+#endif
@@ -0,0 +1,157 @@
+/*******************************************************************************
+ *  headless.cpp
+ *
+ *  This file defines headless mode, which runs the main game simulation with
+ *  no window, renderer, audio or fonts, as fast as the CPU will let it.  It's
+ *  meant for soak tests and balance sweeps on machines without a display or a
+ *  sound card.  When it's done, it prints out the tick rate along with some
+ *  stats about the scores of the games that were played.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*  Score tracking for all of the games finished during the run */
+static Uint32 gamesFinished = 0;
+static Uint64 scoreTotal = 0;
+static Uint32 scoreMin = 0;
+static Uint32 scoreMax = 0;
+
+/*  Set when a game ends; the next one starts once the current tick is done */
+static bool gameEnded = false;
+
+
+
+/*
+--------------------------------------------------------------------------------
+                               HEADLESS GAME OVER
+--------------------------------------------------------------------------------
+ *  Stand-in for the game over flow when there's nobody watching:  tally the
+ *  final score and flag that a new game should start.  We can't reset right
+ *  here, since this gets called from the middle of the enemy update loop.
+*/
+void headless_game_over( void )
+{
+    /*  Record the score */
+    if( gamesFinished == 0 || currentScore < scoreMin )
+        scoreMin = currentScore;
+    if( gamesFinished == 0 || currentScore > scoreMax )
+        scoreMax = currentScore;
+    scoreTotal += currentScore;
+    ++gamesFinished;
+
+    gameEnded = true;
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                  RUN HEADLESS
+--------------------------------------------------------------------------------
+ *  Init what we need, run the game update for headlessFrames ticks (or until
+ *  the replay is over, if we're playing one), then print the results.
+ *  Returns the program's exit code.
+*/
+int run_headless( void )
+{
+    /*  Init the little bit of SDL we need */
+    if( ! init_headless() )
+    {
+        printf("ERROR:  Could not init headless mode.\n");
+        return( 1 );
+    }
+
+    /*  Load the sprite sheets (for their colliders) */
+    if( ! load_headless_media() )
+    {
+        printf("ERROR:  Could not load media.\n");
+        return( 1 );
+    }
+
+    /*  Init the player and the star field */
+    load_player();
+    load_starfield();
+
+    /*  Start a game */
+    reset();
+    currentScreen = SCREEN_MAIN;
+
+    /*  Run the simulation flat out */
+    bool replaying = ( replayMode == REPLAY_PLAY );
+    Uint32 ticks = 0;
+    Uint64 start = SDL_GetPerformanceCounter();
+
+    while( ! quit )
+    {
+        /*  Replays run until they're over, everything else for N ticks */
+        if( replaying ? replayMode != REPLAY_PLAY : ticks >= headlessFrames )
+            break;
+
+        Uint64 tickStart = SDL_GetPerformanceCounter();
+
+        PROFILE_BEGIN_FRAME();
+        {
+            PROFILE_SCOPE( PROF_UPDATE );
+            update();
+        }
+        PROFILE_END_FRAME();
+
+        if( stress )
+        {
+            WorldView view = get_live_view();
+            stress_sample( SDL_GetPerformanceCounter() - tickStart, view );
+        }
+
+        /*  The replay ran out partway through that tick */
+        if( quit )
+            break;
+
+        /*  If that was the end of a game, start another */
+        if( gameEnded )
+        {
+            reset();
+            gameEnded = false;
+        }
+
+        ++ticks;
+    }
+
+    Uint64 elapsed = SDL_GetPerformanceCounter() - start;
+    double seconds = (double)elapsed / (double)SDL_GetPerformanceFrequency();
+
+    /*  Print the results */
+    printf("Seed:             %llu\n", (unsigned long long)rngSeed );
+    printf("Ticks:            %u\n", ticks );
+    printf("Seconds:          %.3f\n", seconds );
+    if( seconds > 0 )
+        printf("Ticks / second:   %.1f\n", ticks / seconds );
+    printf("Games finished:   %u\n", gamesFinished );
+    if( gamesFinished > 0 )
+    {
+        printf("Score (min):      %u\n", scoreMin );
+        printf("Score (avg):      %.1f\n",
+                (double)scoreTotal / (double)gamesFinished );
+        printf("Score (max):      %u\n", scoreMax );
+    }
+    printf("Score (current):  %u\n", currentScore );
+    if( collisionChecks > 0 )
+    {
+        printf("Enemy checks:     %llu (%.1f%% skipped)\n",
+                (unsigned long long)collisionChecks,
+                100.0 * (double)collisionSkips / (double)collisionChecks );
+    }
+
+    if( stress )
+        stress_report();
+
+    /*  Close everything out */
+    if( replayMode != REPLAY_OFF )
+        stop_replay();
+    profiler.close_csv();
+    close_headless();
+
+    return( 0 );
+}
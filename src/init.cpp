@@ -131,7 +131,8 @@ bool init( void )
 
 
     /*  Just for shits and giggles, we'll seed random here */
-    srand( (unsigned int)time(NULL) );
+    if( ! seedGiven )
+        seed_random( (Uint64)time(NULL) );
 
     /*  Init boundary dimensions */
     BWIDTH = WWIDTH;
@@ -146,7 +147,50 @@ bool init( void )
     /*  Init transitions */
     init_transition();
 
+    /*  Start the worker threads */
+    jobs.start( jobThreads );
+
 
     /*  If we made it this far, we're golden */
     return( true );
 }
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                 INIT HEADLESS
+--------------------------------------------------------------------------------
+ *  Init for headless runs.  No window, no renderer, no audio and no fonts;
+ *  just SDL_image so we can read the sprite sheets for their colliders, plus
+ *  the non-SDL bits of the regular init.
+*/
+bool init_headless( void )
+{
+    /*  Init SDL_image */
+    if( ( IMG_Init( IMG_INIT_PNG ) & IMG_INIT_PNG ) == false )
+    {
+        printf("ERROR:  Could not init SDL_image.  IMG Error:  %s\n",
+                IMG_GetError() );
+        return( false );
+    }
+
+    /*  Seed random */
+    if( ! seedGiven )
+        seed_random( (Uint64)time(NULL) );
+
+    /*  Init boundary dimensions */
+    BWIDTH = WWIDTH;
+    BHEIGHT = WHEIGHT - 100;
+
+    /*  Init colors */
+    init_colors();
+
+    /*  Init transitions */
+    init_transition();
+
+    /*  Start the worker threads */
+    jobs.start( jobThreads );
+
+    return( true );
+}
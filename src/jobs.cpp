@@ -0,0 +1,363 @@
+/*******************************************************************************
+ *  jobs.cpp
+ *
+ *  This file defines the job pool, which spreads independent pieces of a tick
+ *  (moving every enemy, the 'atari' explosions and the debris clouds) over a
+ *  few worker threads.  The jobs only ever write to their own items, and anything
+ *  that has to happen in order is done after waiting on them, so the results
+ *  are the same no matter how many threads there are or who ran what.
+ *
+ *  Work is only ever handed out (and waited on) by whichever thread runs the
+ *  simulation.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*
+--------------------------------------------------------------------------------
+                                  CONSTRUCTOR
+--------------------------------------------------------------------------------
+*/
+JobPool::JobPool( void )
+{
+    for( int i = 0; i <= JOB_MAX_THREADS; ++i )
+        mQueues[ i ].lock = NULL;
+
+    for( int i = 0; i < JOB_MAX_THREADS; ++i )
+    {
+        mWorkers[ i ].pool = this;
+        mWorkers[ i ].queue = i + 1;
+        mWorkers[ i ].thread = NULL;
+    }
+
+    mThreads = 0;
+    mNextQueue = 0;
+    mSleepLock = NULL;
+    mWake = NULL;
+    mDone = NULL;
+
+    SDL_AtomicSet( &mQueued, 0 );
+    SDL_AtomicSet( &mRunning, 0 );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   DESTRUCTOR
+--------------------------------------------------------------------------------
+*/
+JobPool::~JobPool( void )
+{
+    stop();
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                     START
+--------------------------------------------------------------------------------
+ *  Start the workers.  If any of it fails we just end up with fewer of them
+ *  (or none, in which case every job runs on the calling thread).
+*/
+bool JobPool::start( int threads )
+{
+    stop();
+
+    /*  By default, one for each core besides the one we're on */
+    if( threads < 0 )
+        threads = SDL_GetCPUCount() - 1;
+    if( threads > JOB_MAX_THREADS )
+        threads = JOB_MAX_THREADS;
+    if( threads <= 0 )
+        return( true );
+
+    mSleepLock = SDL_CreateMutex();
+    mWake = SDL_CreateCond();
+    mDone = SDL_CreateCond();
+    if( mSleepLock == NULL || mWake == NULL || mDone == NULL )
+    {
+        printf("WARNING:  Could not create job pool.  SDL Error:  %s\n",
+                SDL_GetError() );
+        stop();
+        return( false );
+    }
+
+    for( int i = 0; i <= threads; ++i )
+    {
+        mQueues[ i ].lock = SDL_CreateMutex();
+        if( mQueues[ i ].lock == NULL )
+        {
+            printf("WARNING:  Could not create job queue.  SDL Error:  %s\n",
+                    SDL_GetError() );
+            stop();
+            return( false );
+        }
+    }
+
+    /*
+     *  The workers look at this, so it has to be set before they start.  If
+     *  one of them doesn't, the jobs dealt to its queue just get stolen.
+     */
+    mThreads = threads;
+    SDL_AtomicSet( &mRunning, 1 );
+
+    bool started = true;
+    for( int i = 0; i < threads; ++i )
+    {
+        mWorkers[ i ].thread = SDL_CreateThread( work, "worker",
+                &mWorkers[ i ] );
+        if( mWorkers[ i ].thread == NULL )
+        {
+            printf("WARNING:  Could not start worker thread.  SDL Error:  %s\n",
+                    SDL_GetError() );
+            started = false;
+        }
+    }
+
+    return( started );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      STOP
+--------------------------------------------------------------------------------
+*/
+void JobPool::stop( void )
+{
+    SDL_AtomicSet( &mRunning, 0 );
+
+    /*  Wake everybody up so they notice */
+    if( mSleepLock != NULL && mWake != NULL )
+    {
+        SDL_LockMutex( mSleepLock );
+        SDL_CondBroadcast( mWake );
+        SDL_UnlockMutex( mSleepLock );
+    }
+
+    for( int i = 0; i < JOB_MAX_THREADS; ++i )
+    {
+        if( mWorkers[ i ].thread != NULL )
+        {
+            SDL_WaitThread( mWorkers[ i ].thread, NULL );
+            mWorkers[ i ].thread = NULL;
+        }
+    }
+
+    for( int i = 0; i <= JOB_MAX_THREADS; ++i )
+    {
+        if( mQueues[ i ].lock != NULL )
+        {
+            SDL_DestroyMutex( mQueues[ i ].lock );
+            mQueues[ i ].lock = NULL;
+        }
+        mQueues[ i ].jobs.clear();
+    }
+
+    if( mWake != NULL )
+    {
+        SDL_DestroyCond( mWake );
+        mWake = NULL;
+    }
+
+    if( mDone != NULL )
+    {
+        SDL_DestroyCond( mDone );
+        mDone = NULL;
+    }
+
+    if( mSleepLock != NULL )
+    {
+        SDL_DestroyMutex( mSleepLock );
+        mSleepLock = NULL;
+    }
+
+    mThreads = 0;
+    mNextQueue = 0;
+    SDL_AtomicSet( &mQueued, 0 );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                  GET THREADS
+--------------------------------------------------------------------------------
+*/
+int JobPool::get_threads( void )
+{
+    return( mThreads );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      RUN
+--------------------------------------------------------------------------------
+ *  Chop the items up into jobs and deal them out over the queues, then wake
+ *  up the workers.  Each job is counted in mQueued before it goes in a queue,
+ *  so a worker that takes it straight away can't take the count below zero.
+*/
+void JobPool::run( JobGroup &group, JobFunction function, void *data,
+        int count, int grain )
+{
+    if( count <= 0 )
+        return;
+
+    if( grain < 1 )
+        grain = 1;
+
+    /*  Not worth handing out */
+    if( mThreads == 0 || count <= grain )
+    {
+        function( data, 0, count );
+        return;
+    }
+
+    int jobs = ( count + grain - 1 ) / grain;
+    SDL_AtomicAdd( &group.pending, jobs );
+
+    for( int begin = 0; begin < count; begin += grain )
+    {
+        Job job;
+        job.function = function;
+        job.data = data;
+        job.begin = begin;
+        job.end = begin + grain < count ? begin + grain : count;
+        job.group = &group;
+
+        SDL_AtomicAdd( &mQueued, 1 );
+
+        JobQueue &queue = mQueues[ mNextQueue ];
+        SDL_LockMutex( queue.lock );
+        queue.jobs.push_back( job );
+        SDL_UnlockMutex( queue.lock );
+
+        mNextQueue = ( mNextQueue + 1 ) % ( mThreads + 1 );
+    }
+
+    SDL_LockMutex( mSleepLock );
+    SDL_CondBroadcast( mWake );
+    SDL_UnlockMutex( mSleepLock );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      WAIT
+--------------------------------------------------------------------------------
+ *  Rather than sit idle, the waiting thread works on jobs too.  Once there's
+ *  nothing left to take, it sleeps until a group finishes (see execute()).
+*/
+void JobPool::wait( JobGroup &group )
+{
+    while( SDL_AtomicGet( &group.pending ) > 0 )
+    {
+        Job job;
+        if( take( 0, job ) )
+        {
+            execute( job );
+            continue;
+        }
+
+        SDL_LockMutex( mSleepLock );
+        while( SDL_AtomicGet( &group.pending ) > 0 &&
+                SDL_AtomicGet( &mQueued ) == 0 )
+            SDL_CondWait( mDone, mSleepLock );
+        SDL_UnlockMutex( mSleepLock );
+    }
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      TAKE
+--------------------------------------------------------------------------------
+ *  Newest job from the back of our own queue if there is one; otherwise the
+ *  oldest one from the front of somebody else's.
+*/
+bool JobPool::take( int queue, Job &job )
+{
+    for( int i = 0; i <= mThreads; ++i )
+    {
+        JobQueue &q = mQueues[ ( queue + i ) % ( mThreads + 1 ) ];
+        bool found = false;
+
+        SDL_LockMutex( q.lock );
+        if( ! q.jobs.empty() )
+        {
+            if( i == 0 )
+            {
+                job = q.jobs.back();
+                q.jobs.pop_back();
+            }
+            else
+            {
+                job = q.jobs.front();
+                q.jobs.pop_front();
+            }
+            found = true;
+        }
+        SDL_UnlockMutex( q.lock );
+
+        if( found )
+        {
+            SDL_AtomicAdd( &mQueued, -1 );
+            return( true );
+        }
+    }
+
+    return( false );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                    EXECUTE
+--------------------------------------------------------------------------------
+ *  Run the job, and if it was the last one in its group, wake up wait()
+*/
+void JobPool::execute( Job &job )
+{
+    job.function( job.data, job.begin, job.end );
+
+    if( SDL_AtomicAdd( &job.group->pending, -1 ) == 1 )
+    {
+        SDL_LockMutex( mSleepLock );
+        SDL_CondBroadcast( mDone );
+        SDL_UnlockMutex( mSleepLock );
+    }
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      WORK
+--------------------------------------------------------------------------------
+ *  Worker thread loop:  run jobs while there are any, sleep when there aren't
+*/
+int JobPool::work( void *data )
+{
+    Worker *worker = (Worker*)data;
+    JobPool *pool = worker->pool;
+
+    while( SDL_AtomicGet( &pool->mRunning ) )
+    {
+        Job job;
+        if( pool->take( worker->queue, job ) )
+        {
+            pool->execute( job );
+            continue;
+        }
+
+        SDL_LockMutex( pool->mSleepLock );
+        while( SDL_AtomicGet( &pool->mQueued ) == 0 &&
+                SDL_AtomicGet( &pool->mRunning ) )
+            SDL_CondWait( pool->mWake, pool->mSleepLock );
+        SDL_UnlockMutex( pool->mSleepLock );
+    }
+
+    return( 0 );
+}
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ *  jobs.h
+ *
+ *  This is the header file for the job pool class, defined in jobs.cpp.
+ *
+*******************************************************************************/
+#ifndef CLASS_JOBS_H
+#define CLASS_JOBS_H
+
+/*  Most worker threads we'll ever start */
+#define JOB_MAX_THREADS 8
+
+/*  A job function, run over items [begin, end) of whatever data it's given */
+typedef void (*JobFunction)( void *data, int begin, int end );
+
+/*
+ *  A set of jobs that can be waited on together.  Anything that depends on
+ *  the jobs in a group waits for the group before it starts.
+ */
+struct JobGroup
+{
+    SDL_atomic_t pending;       //  Jobs not finished yet
+
+    JobGroup( void )
+    {
+        SDL_AtomicSet( &pending, 0 );
+    }
+};
+
+/*  One chunk of work */
+struct Job
+{
+    JobFunction function;
+    void *data;
+    int begin;
+    int end;
+    JobGroup *group;
+};
+
+/*
+ *  The JobPool class
+ *
+ *  A small work-stealing thread pool.  Every worker, and the thread handing
+ *  out the work, has its own queue.  Each takes jobs from the back of its own
+ *  queue and, once that's empty, steals from the front of the others'.
+ *
+ *  The queues are plain deques, each behind its own mutex, rather than
+ *  lock-free deques.  There are only a handful of jobs a tick, so the locks
+ *  are hardly ever fought over.
+ */
+class JobPool
+{
+    public:
+        /*  Constructor */
+        JobPool( void );
+
+        /*  Destructor */
+        ~JobPool( void );
+
+        /*  Start the given number of workers (-1 for one per spare core) */
+        bool start( int threads );
+
+        /*  Stop and wait for all of the workers */
+        void stop( void );
+
+        /*  Number of workers running */
+        int get_threads( void );
+
+        /*
+         *  Split items [0, count) into jobs of up to 'grain' items and add them
+         *  to the group.  With no workers, or only one job's worth of items,
+         *  it all just runs right here and now.
+         */
+        void run( JobGroup &group, JobFunction function, void *data,
+                int count, int grain );
+
+        /*  Help out with the jobs until everything in the group is done */
+        void wait( JobGroup &group );
+
+    private:
+        /*  A queue, and the lock that goes with it */
+        struct JobQueue
+        {
+            SDL_mutex *lock;
+            std::deque<Job> jobs;
+        };
+
+        /*  What a worker thread gets handed when it starts */
+        struct Worker
+        {
+            JobPool *pool;
+            int queue;
+            SDL_Thread *thread;
+        };
+
+        /*  Get a job from our own queue, or steal one from another */
+        bool take( int queue, Job &job );
+
+        /*  Run a job and mark it done */
+        void execute( Job &job );
+
+        /*  The worker threads' loop */
+        static int work( void *data );
+
+        /*  Queue 0 belongs to the thread handing out work */
+        JobQueue mQueues[ JOB_MAX_THREADS + 1 ];
+        Worker mWorkers[ JOB_MAX_THREADS ];
+        int mThreads;
+
+        /*  Where the next job goes */
+        int mNextQueue;
+
+        /*
+         *  Jobs sitting in the queues, what idle workers sleep on, and what
+         *  wait() sleeps on when there's nothing left for it to take
+         */
+        SDL_atomic_t mQueued;
+        SDL_mutex *mSleepLock;
+        SDL_cond *mWake;
+        SDL_cond *mDone;
+
+        /*  Cleared to tell the workers to finish up */
+        SDL_atomic_t mRunning;
+};
+
+#endif
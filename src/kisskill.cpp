@@ -37,11 +37,24 @@ KissKill::~KissKill( void )
 --------------------------------------------------------------------------------
                                      CLEAR
 --------------------------------------------------------------------------------
- *  Clears out the kk structs vector
+ *  Clears out the kk structs
 */
 void KissKill::clear( void )
 {
-    mKissKills.clear();
+    mFirst = 0;
+    mCount = 0;
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                    GET SLOT
+--------------------------------------------------------------------------------
+*/
+kissKill& KissKill::get_slot( int n )
+{
+    return( mKissKills[ ( mFirst + n ) % KISSKILLS_MAX ] );
 }
 
 
@@ -50,31 +63,32 @@ void KissKill::clear( void )
 --------------------------------------------------------------------------------
                                       ADD
 --------------------------------------------------------------------------------
- *  Adds a new kissKill struct object to the mKissKills vector
+ *  Puts a new kissKill on the back of the ring, dropping the oldest one if
+ *  need be.  This only records what to draw; render() draws the text from the
+ *  glyph atlas, so this is safe to call from the simulation.
 */
 bool KissKill::add( int x, int y, const char *string, SDL_Color &color )
 {
-    /*  Create our struct instance and set default values */
-    kissKill kk;
-    kk.texture = NULL;
-    kk.isActive = false;
-
-    /*  Create a texture */
-    kk.texture = new Texture();
-    if( ! kk.texture->create_texture_from_string( gFontTiny, string, color ) )
+    /*  Nobody's watching in headless mode (but stress tests count them) */
+    if( headless && ! stress )
+        return( true );
+
+    /*  Full up, so the oldest one goes */
+    if( mCount == KISSKILLS_MAX )
     {
-        printf("ERROR:  Could not create kiss/kill OSD\n");
-        return( false );
+        mFirst = ( mFirst + 1 ) % KISSKILLS_MAX;
+        --mCount;
     }
 
-    /*  Set the texture's position */
-    kk.texture->set_position( x, y );
-
-    /*  Switch it to active */
+    /*  Fill in the next slot */
+    kissKill &kk = get_slot( mCount );
+    kk.pos.x = x;
+    kk.pos.y = y;
+    snprintf( kk.text, sizeof( kk.text ), "%s", string );
+    kk.color = color;
+    kk.alpha = 255;
     kk.isActive = true;
-
-    /*  Push it on to the vector */
-    mKissKills.push_back( kk );
+    ++mCount;
 
     return( true );
 }
@@ -84,58 +98,61 @@ bool KissKill::add( int x, int y, const char *string, SDL_Color &color )
 --------------------------------------------------------------------------------
                                      UPDATE
 --------------------------------------------------------------------------------
- *  Get rid of dead kiss/kill texture objects
+ *  Fade the kiss/kills out and get rid of the dead ones
 */
 void KissKill::update( void )
 {
-    /*  Create our iterator */
-    std::vector<kissKill>::iterator k;
-
-    /*  Iterate through vector, cleaning out the dead kk structs */
-    for( k = mKissKills.begin(); k != mKissKills.end(); )
+    /*  Clean out the dead kk structs, which are always at the front */
+    while( mCount > 0 && ! get_slot( 0 ).isActive )
     {
-        if( ! k->isActive )
-            mKissKills.erase( k );
-        else
-            ++k;
+        mFirst = ( mFirst + 1 ) % KISSKILLS_MAX;
+        --mCount;
     }
 
-    /*  Create our alpha variable up here */
-    Uint8 alpha = 0;
-
-    /*  Go through the vector again, updating the active kk structs */
-    for( k = mKissKills.begin(); k != mKissKills.end(); ++k )
+    for( int i = 0; i < mCount; ++i )
     {
-        /*  Grab the alpha from the texture */
-        alpha = k->texture->get_alpha();
+        kissKill &k = get_slot( i );
 
         /*  Modify alpha value */
-        if( alpha > 16 )
-            alpha -= 16;
+        if( k.alpha > 16 )
+            k.alpha -= 16;
 
         /*  If it's too low, set alpha to zero and deactive the kk */
         else
         {
-            alpha = 0;
-            k->isActive = false;
+            k.alpha = 0;
+            k.isActive = false;
         }
-
-        /*  Give it back to the texture */
-        k->texture->set_alpha( alpha );
     }
 }
 
 
 
+/*
+--------------------------------------------------------------------------------
+                                   GET COUNT
+--------------------------------------------------------------------------------
+*/
+int KissKill::get_count( void )
+{
+    return( mCount );
+}
+
+
+
 /*
 --------------------------------------------------------------------------------
                                      RENDER
 --------------------------------------------------------------------------------
- *  Render all of our precious kk struct texture objects
+ *  Render all of our precious kk structs
 */
 void KissKill::render( void )
 {
-    std::vector<kissKill>::iterator k;
-    for( k = mKissKills.begin(); k != mKissKills.end(); ++k )
-        k->texture->render_self();
+    for( int i = 0; i < mCount; ++i )
+    {
+        const kissKill &k = get_slot( i );
+
+        gFontTinyAtlas->render( k.text, k.pos.x, k.pos.y, k.color, k.alpha );
+    }
 }
+
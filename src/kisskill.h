@@ -7,14 +7,27 @@
 #ifndef CLASS_KISSKILL_H
 #define CLASS_KISSKILL_H
 
+/*  Most kiss/kills on screen at once (the oldest make way for new ones) */
+#define KISSKILLS_MAX 256
+
 struct kissKill
 {
-    Texture *texture;   //  Texture object pointer
+    SDL_Point pos;      //  Where to draw it
+    char text[ 16 ];    //  What it says
+    SDL_Color color;    //  Color of the text
+    Uint8 alpha;        //  Current alpha value (it fades out)
     bool isActive;      //  Is this OSD still active?
 };
 
 /*
  *  The KissKill class
+ *
+ *  A fixed ring of slots, oldest first.  Every kiss/kill fades at the same
+ *  rate, so they die in the order they were added, off the front of the ring,
+ *  and a new one just goes on the back.  If the ring is full, the oldest (and
+ *  faintest) one is dropped to make room.  Nothing is ever allocated, and the
+ *  text is drawn from gFontTinyAtlas, so there are no textures to look after
+ *  either.
  */
 class KissKill
 {
@@ -25,7 +38,7 @@ class KissKill
         /*  Destructor */
         ~KissKill( void );
 
-        /*  Clear out the vector */
+        /*  Clear out the ring */
         void clear( void );
 
         /*  Add a new kiss/kill OSD */
@@ -34,13 +47,22 @@ class KissKill
         /*  Update function */
         void update( void );
 
-        /*  Renders all of the kiss/kill texture objects */
+        /*  Number of kiss/kills on the go */
+        int get_count( void );
+
+        /*  Renders all of the kiss/kills' text */
         void render( void );
 
     private:
+        /*  Get at the nth oldest kiss/kill */
+        kissKill& get_slot( int n );
+
         /*  Store our kissKill structs */
-        std::vector<kissKill> mKissKills;
+        kissKill mKissKills[ KISSKILLS_MAX ];
 
+        /*  Where the oldest one is, and how many there are */
+        int mFirst;
+        int mCount;
 };
 
 #endif
@@ -61,23 +61,9 @@ bool load_text( void )
         return( false );
     }
 
-    /*  Score display */
-    scoreText = new Texture();
-    if( ! scoreText->create_texture_from_string( gFontTiny, "000000",
-                textColor ) )
-    {
-        printf("ERROR:  Could not load score text texture.\n");
-        return( false );
-    }
-
-    /*  High score display */
-    highScoreText = new Texture();
-    if( ! highScoreText->create_texture_from_string( gFontTiny, "000000",
-                textColor ) )
-    {
-        printf("ERROR:  Could not load high score text texture.\n");
-        return( false );
-    }
+    /*  Score displays (drawn from gFontTinyAtlas) */
+    snprintf( currentScoreString, sizeof( currentScoreString ), "000000" );
+    snprintf( highScoreString, sizeof( highScoreString ), "000000" );
 
 
 
@@ -229,43 +215,84 @@ bool load_music( void )
 
 
 
+/*  Size of each asteroid scale, as a percentage of the full-size sprite */
+static const int asteroidScalePercents[ ASTEROID_SCALES + 1 ] =
+{
+    0, 100, 75, 50, 33
+};
+
+
+
 /*
 --------------------------------------------------------------------------------
-                                   LOAD MEDIA
+                               LOAD SPRITE SHEETS
 --------------------------------------------------------------------------------
- *  Master media loading function.  This directly loads the loading of most
- *  unique textures used on the 'main screen' during play, while calling the
- *  other media loading functions to load those as well.
+ *  Load the ship and asteroid textures, along with the sprite sheets holding
+ *  their clips, colliders and masks.  Each smaller asteroid size gets a sheet
+ *  of its own, scaled down from the full-size one, so nothing about their
+ *  shapes has to be worked out as they come and go.
 */
-bool load_media( void )
+bool load_sprite_sheets( void )
 {
     /*  Player's normal texture (sprite sheet) */
+    playerSheet = new SpriteSheet();
     playerTexture = new Texture();
-    if( ! playerTexture->create_texture_from_file("data/gfx/ship.png", true,
-                77, 77, 30 ) )
+    if( ! playerTexture->create_texture_from_file("data/gfx/ship.png",
+                playerSheet, 77, 30 ) )
     {
         printf("ERROR:  Could not load player texture\n");
         return( false );
     }
 
-    /*  Player's white (powered) texture (sprite sheet) */
+    /*  Player's white (powered) texture, the same shapes in white */
     playerWhiteTexture = new Texture();
     if( ! playerWhiteTexture->create_texture_from_file(
-                "data/gfx/ship-white.png", true, 77, 77, 30 ) )
+                "data/gfx/ship-white.png" ) )
     {
         printf("ERROR:  Could not load white player texture\n");
         return( false );
     }
+    playerWhiteTexture->set_sprite_sheet( playerSheet );
 
-    /*  Enemy texture (sprite sheet) */
+    /*  Enemy texture (sprite sheet), at full size... */
+    enemySheets[ 1 ] = new SpriteSheet();
     enemyTexture = new Texture();
     if( ! enemyTexture->create_texture_from_file("data/gfx/asteroids.png",
-                true, 99, 99, 12 ) )
+                enemySheets[ 1 ], 99, ASTEROID_FRAMES ) )
     {
         printf("ERROR:  Could not load enemy texture.\n");
         return( false );
     }
 
+    /*  ...and each smaller size, shared by every asteroid of that size */
+    int fullSize = enemySheets[ 1 ]->get_size();
+    for( int scale = 2; scale <= ASTEROID_SCALES; ++scale )
+    {
+        enemySheets[ scale ] = new SpriteSheet();
+        enemySheets[ scale ]->init_scaled( enemySheets[ 1 ],
+                fullSize * asteroidScalePercents[ scale ] / 100 );
+    }
+    Asteroids::init_shapes( enemyTexture, enemySheets );
+
+    return( true );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                   LOAD MEDIA
+--------------------------------------------------------------------------------
+ *  Master media loading function.  This directly loads the loading of most
+ *  unique textures used on the 'main screen' during play, while calling the
+ *  other media loading functions to load those as well.
+*/
+bool load_media( void )
+{
+    /*  Player and asteroid sprite sheets */
+    if( ! load_sprite_sheets() )
+        return( false );
+
     /*  Panel background texture */
     panelBackground = new Texture();
     if( ! panelBackground->create_texture_from_file(
@@ -320,6 +347,24 @@ bool load_media( void )
 
 
 
+/*
+--------------------------------------------------------------------------------
+                              LOAD HEADLESS MEDIA
+--------------------------------------------------------------------------------
+ *  Headless runs only need the ship and asteroid sprite sheets, and only for
+ *  their dimensions and pixel colliders (there's no renderer to upload to).
+*/
+bool load_headless_media( void )
+{
+    /*  Player and asteroid sprite sheets */
+    if( ! load_sprite_sheets() )
+        return( false );
+
+    return( true );
+}
+
+
+
 /*
 --------------------------------------------------------------------------------
                                    LOAD FONTS
@@ -355,6 +400,17 @@ bool load_fonts( void )
         return( false );
     }
 
+    /*  And the glyph atlases for each of them */
+    gFontAtlas = new GlyphAtlas();
+    gFontSmallAtlas = new GlyphAtlas();
+    gFontTinyAtlas = new GlyphAtlas();
+    if( ! gFontAtlas->init( gFont ) || ! gFontSmallAtlas->init( gFontSmall ) ||
+            ! gFontTinyAtlas->init( gFontTiny ) )
+    {
+        printf("ERROR:  Could not create glyph atlases.\n");
+        return( false );
+    }
+
     return( true );
 }
 
@@ -379,11 +435,11 @@ void load_player( void )
     player.set_max_frames( 30 );
     player.set_current_frame( 14 );
 
-    /*  Get the player's ship texture's width */
-    int w = player.get_texture_width();
+    /*  The clips and colliders */
+    player.set_sprite_sheet( playerSheet );
 
-    /*  Init player clips - rows, columns, width, height */
-    player.init_clips_vertical( w, w, 30 );
+    /*  Get the size of the player's ship */
+    int w = playerSheet->get_size();
 
     /*  Init width and height (scale player ship) */
     player.set_width( w );
@@ -393,9 +449,6 @@ void load_player( void )
     player.set_position(
             ( BWIDTH - player.get_width() ) / 2,
             ( BHEIGHT - player.get_height() ) - 10 );
-
-    /*  Adjust the colliders for the player's ship */
-    player.translate_colliders( 1 );
 }
 
 
@@ -404,54 +457,23 @@ void load_player( void )
 --------------------------------------------------------------------------------
                                    LOAD ENEMY
 --------------------------------------------------------------------------------
- *  Create, init and adjust enemy object
+ *  Add an asteroid of random size, speed and look just above the play area
 */
 void load_enemy( void )
 {
-    /*  Create new enemy object */
-    Enemy enemy;
-
-    /*  Init some more variables */
-    enemy.init_enemy();
-
-    /*  Set its texture object */
-    enemy.set_texture_object( enemyTexture );
-
     /*  Create semi-random scale size and speed */
-    int scaleSize = ( rand() % 2 ) + 1;
-    int speed = ( (rand()%6) + 1 ) * 2;
-
-    /*  Init the point values */
-    enemy.init_point_values( scaleSize, speed );
-
-    /*  Adjust the dimensions according to random size */
-    int w = enemy.get_texture_width();
-    enemy.set_width( w / scaleSize );
-    enemy.set_height( w / scaleSize );
+    int scaleSize = rng[ RNG_GAMEPLAY ].range( ASTEROID_SCALES ) + 1;
+    int speed = ( rng[ RNG_GAMEPLAY ].range( 6 ) + 1 ) * 2;
 
     /*  Set position:  random X position, Y pos = 'above' visible play area */
-    enemy.set_position( ( (rand() % BWIDTH) + 1), -(enemy.get_height()*2) );
-
-    /*  Set the enemy's velocity to random speed */
-    enemy.set_velocity( speed );
-
-    /*  Set the enemy's direction downward */
-    enemy.set_direction( 1 );
-
-    /*  Set frame info */
-    enemy.set_max_frames( 12 );
+    int size = enemySheets[ scaleSize ]->get_size();
+    int x = rng[ RNG_GAMEPLAY ].range( BWIDTH ) + 1;
 
     /*  Randomly select one of the 12 'clips' */
-    enemy.set_current_frame( rand() % 12 );
-
-    /*  Init clips - rows, columns, width, height */
-    enemy.init_clips_vertical( w, w, 12 );
-
-    /*  Translate colliders */
-    enemy.translate_colliders( scaleSize );
+    int frame = rng[ RNG_GAMEPLAY ].range( ASTEROID_FRAMES );
 
-    /*  Push the new enemy onto the enemies vector */
-    enemies.push_back( enemy );
+    /*  Add it to the asteroids; if they're full up, it just doesn't appear */
+    enemies.add( x, -( size * 2 ), scaleSize, speed, frame );
 }
 
 
@@ -467,16 +489,13 @@ void load_panel( void )
     /*  Assign all of the texture objects to the panel */
     panel.set_panel_texture_background( panelBackground );
     panel.set_panel_texture_buttons( panelButtons );
-    panel.set_score_texture_object( scoreText );
-    panel.set_high_score_texture_object( highScoreText );
 
     /*  Adjust panel dimensions */
     panel.set_width( BWIDTH );
     panel.set_height( 100 );
     
-    /*  Adjust the positions of the panel and everything on it */
+    /*  Adjust the position of the panel (everything on it follows) */
     panel.set_position( 0, BHEIGHT );
-    panel.layout();
 }
 
 
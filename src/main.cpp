@@ -41,6 +41,26 @@ int main( int argc, char *argv[] )
     else if( aReturn == 1 )
         return( 1 );
 
+#ifdef PROFILING
+    /*  Open the profile output file, if they asked for one */
+    if( ! profileOutPath.empty() && ! profiler.open_csv(
+                profileOutPath.c_str() ) )
+        return( 1 );
+#endif
+
+    /*
+     *  Open the replay file now; playback has to seed the random streams
+     *  before anything uses them
+     */
+    if( replayMode == REPLAY_RECORD && ! start_recording( replayPath.c_str() ) )
+        return( 1 );
+    if( replayMode == REPLAY_PLAY && ! start_replay( replayPath.c_str() ) )
+        return( 1 );
+
+    /*  Headless runs don't need any of the stuff below */
+    if( headless )
+        return( run_headless() );
+
     /*  Init SDL and its subsystems */
     if( ! init() )
     {
@@ -112,8 +132,15 @@ int main( int argc, char *argv[] )
     /*  Grab mouse */
     SDL_SetRelativeMouseMode( SDL_TRUE );
 
-    /*  Play the menu theme right off the bat if music is allowed */
-    if( playMusic )
+    /*  Recordings and replays skip the menu and go straight into a game */
+    if( replayMode != REPLAY_OFF )
+    {
+        reset();
+        currentScreen = SCREEN_MAIN;
+    }
+
+    /*  Otherwise, play the menu theme right off the bat if music is allowed */
+    else if( playMusic )
     {
         if( Mix_PlayMusic( musicMenu, -1 ) == -1 )
         {
@@ -122,31 +149,113 @@ int main( int argc, char *argv[] )
         }
     }
 
+    /*
+     *  The simulation runs in fixed steps of 1/FPS seconds, no matter how
+     *  often we actually get to draw.  Real elapsed time (from the performance
+     *  counter) is poured into the accumulator every frame and drained one
+     *  tick at a time; whatever is left over tells the renderer how far we are
+     *  between the last two simulation states.
+     */
+    Uint64 tickLength = SDL_GetPerformanceFrequency() / FPS;
+    Uint64 previousCounter = SDL_GetPerformanceCounter();
+    Uint64 accumulator = 0;
+
+    /*  Keeps frames evenly spaced when we're not using vsync */
+    FramePacer pacer;
+    pacer.set_rate( FPS );
+
+    /*
+     *  Threaded mode runs its own loop until the player quits.  If the threads
+     *  couldn't be started, just carry on with the usual loop below.
+     */
+    if( threaded && ! run_threaded( pacer ) )
+        threaded = false;
+
     /*  While the player hasn't elected to quit */
     while( quit == false )
     {
+        PROFILE_BEGIN_FRAME();
+
+        /*  Find out how much time has passed since the last frame */
+        Uint64 currentCounter = SDL_GetPerformanceCounter();
+        Uint64 frameTime = currentCounter - previousCounter;
+        previousCounter = currentCounter;
+
+        /*
+         *  If we were stalled for a long while (window dragged, debugger,
+         *  whatever), don't try to catch up all at once or we'll never draw
+         *  again.  The game just runs a little slow for that one frame.
+         */
+        if( frameTime > tickLength * MAX_TICKS_PER_FRAME )
+            frameTime = tickLength * MAX_TICKS_PER_FRAME;
+
+        accumulator += frameTime;
+
         /*  Handle all events */
-        handle_events( e );
+        {
+            PROFILE_SCOPE( PROF_EVENTS );
+            handle_events( e );
+        }
+
+        /*  Update everything, once for every tick we owe the simulation */
+        {
+            PROFILE_SCOPE( PROF_UPDATE );
+            while( accumulator >= tickLength )
+            {
+                update();
+                accumulator -= tickLength;
+            }
+        }
 
-        /*  Update everything */
-        update();
+        /*  How far between the previous and the current tick we are */
+        tickInterpolation = (float)accumulator / (float)tickLength;
 
         /*  Draw the window background */
         SDL_SetRenderDrawColor( gRenderer, 0, 0, 0, 255 );
         SDL_RenderClear( gRenderer );
 
         /*  Render everything else */
-        render();
+        {
+            PROFILE_SCOPE( PROF_RENDER );
+            render();
+            PROFILE_RENDER();
+        }
 
         /*  Show what's been rendered */
-        SDL_RenderPresent( gRenderer );
+        {
+            PROFILE_SCOPE( PROF_PRESENT );
+            SDL_RenderPresent( gRenderer );
+        }
 
-        /*  Basic delay */
+        PROFILE_END_FRAME();
+
+        /*  Keep track of what live play is costing, if this is a stress test */
+        if( stress && currentScreen == SCREEN_MAIN )
+        {
+            WorldView view = get_live_view();
+            stress_sample( SDL_GetPerformanceCounter() - currentCounter, view );
+        }
+
+        /*  Wait for the next frame, if we're not vsyncing */
         if( limitFPS )
-            SDL_Delay( 1000 / FPS );
+            pacer.wait();
     }
 
+    /*  Let them know how well we kept up */
+    if( limitFPS && pacer.get_frames() > 0 )
+    {
+        printf("Frame pacing:  %llu of %llu frames missed their deadline\n",
+                (unsigned long long)pacer.get_missed(),
+                (unsigned long long)pacer.get_frames() );
+    }
+
+    if( stress )
+        stress_report();
+
     /*  Close everything out */
+    if( replayMode != REPLAY_OFF )
+        stop_replay();
+    profiler.close_csv();
     close();
 
     return(0);
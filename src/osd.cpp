@@ -15,15 +15,11 @@
 --------------------------------------------------------------------------------
                                     FREE OSD
 --------------------------------------------------------------------------------
- *  Deletes the OSD texture and nulls the pointer
+ *  Clears out the OSD text
 */
 void free_osd( void )
 {
-    if( OSD != NULL )
-    {
-        delete OSD;
-        OSD = NULL;
-    }
+    osdString[ 0 ] = '\0';
 }
 
 
@@ -36,20 +32,11 @@ void free_osd( void )
 */
 void osd( const char *string )
 {
-    /*  Free old OSD texture object if it exists */
-    free_osd();
-
-    /*  Create a brand new one */
-    OSD = new Texture();
-
-    /*  Load the string into it */
-    if( ! OSD->create_texture_from_string( gFont, string, colors[COLOR_WHITE]) )
-    {
-        printf("WARNING:  Could not create OSD!\n");
-    }
+    /*  Just hang on to the text; it's drawn from the glyph atlas */
+    snprintf( osdString, sizeof( osdString ), "%s", string );
 
-    /*  Position the OSD at the top-center of the screen */
-    OSD->set_position( ( BWIDTH - OSD->get_width() ) / 2, 40 );
+    /*  Start it out fully opaque */
+    osdAlpha = 255;
 }
 
 
@@ -59,23 +46,18 @@ void osd( const char *string )
                                    UPDATE OSD
 --------------------------------------------------------------------------------
  *  Updates the OSD, which in effect just makes it visually fade away over time.
+ *  Only the alpha value is touched here; the text belongs to the render side
+ *  and sticks around (invisible) until the next osd() call.
 */
 void update_osd( void )
 {
-    /*  If the OSD exists */
-    if( OSD != NULL )
-    {
-        /*  Get the alpha value from the texture object */
-        Uint8 alpha = OSD->get_alpha();
-
-        /*  If the value is higher than 8, lower it */
-        if( alpha > 8 )
-            OSD->set_alpha( alpha - 8 );
+    /*  If the value is higher than 8, lower it */
+    if( osdAlpha > 8 )
+        osdAlpha -= 8;
 
-        /*  Otherwise, we're done with this OSD instance */
-        else
-            free_osd();
-    }
+    /*  Otherwise, we're done with this OSD */
+    else
+        osdAlpha = 0;
 }
 
 
@@ -84,11 +66,14 @@ void update_osd( void )
 --------------------------------------------------------------------------------
                                    RENDER OSD
 --------------------------------------------------------------------------------
- *  Renders the OSD to the screen
+ *  Renders the OSD at the top-center of the screen at the given alpha value
 */
-void render_osd( void )
+void render_osd( Uint8 alpha )
 {
-    /*  If the OSD exists, render it */
-    if( OSD != NULL )
-        OSD->render_self();
+    /*  If there's an OSD and it hasn't faded out, render it */
+    if( osdString[ 0 ] != '\0' && alpha > 0 )
+    {
+        int x = ( BWIDTH - gFontAtlas->get_text_width( osdString ) ) / 2;
+        gFontAtlas->render( osdString, x, 40, colors[ COLOR_WHITE ], alpha );
+    }
 }
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ *  pacer.cpp
+ *
+ *  This file defines the frame pacer class, which keeps frames coming out at
+ *  an even rate when vsync isn't doing it for us (--limit-fps).
+ *
+ *  Deadlines are kept on the performance counter and advance by exactly one
+ *  frame each time, so there's no drift and no truncation to whole
+ *  milliseconds.  We sleep for most of whatever's left of the frame, then
+ *  spin for the last bit, since SDL_Delay() can easily oversleep by a
+ *  millisecond or more.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*
+--------------------------------------------------------------------------------
+                                  CONSTRUCTOR
+--------------------------------------------------------------------------------
+*/
+FramePacer::FramePacer( void )
+{
+    mMillisecond = SDL_GetPerformanceFrequency() / 1000;
+    mDeadline = 0;
+    mFrames = 0;
+    mMissed = 0;
+
+    set_rate( DEFAULT_FPS );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   DESTRUCTOR
+--------------------------------------------------------------------------------
+*/
+FramePacer::~FramePacer( void )
+{
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                    SET RATE
+--------------------------------------------------------------------------------
+*/
+void FramePacer::set_rate( unsigned int fps )
+{
+    mFrameLength = SDL_GetPerformanceFrequency() / fps;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      WAIT
+--------------------------------------------------------------------------------
+ *  Wait out the rest of the current frame.  If we're already past the
+ *  deadline, the frame is counted as missed and we don't wait at all.
+*/
+void FramePacer::wait( void )
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    /*  The first frame just sets things up */
+    if( mDeadline == 0 )
+    {
+        mDeadline = now + mFrameLength;
+        return;
+    }
+
+    ++mFrames;
+
+    if( now > mDeadline )
+        ++mMissed;
+
+    else
+    {
+        /*  Sleep, leaving a couple of milliseconds' margin */
+        Uint64 remaining = mDeadline - now;
+        if( remaining > mMillisecond * 2 )
+            SDL_Delay( (Uint32)( ( remaining / mMillisecond ) - 2 ) );
+
+        /*  Then spin for the rest */
+        while( SDL_GetPerformanceCounter() < mDeadline )
+            ;
+
+        now = mDeadline;
+    }
+
+    /*  The next frame is due one frame after this one was */
+    mDeadline += mFrameLength;
+
+    /*  If we've fallen more than a frame behind, don't try to catch up */
+    if( mDeadline < now )
+        mDeadline = now + mFrameLength;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                               GET FRAMES / MISSED
+--------------------------------------------------------------------------------
+*/
+Uint64 FramePacer::get_frames( void )
+{
+    return( mFrames );
+}
+
+Uint64 FramePacer::get_missed( void )
+{
+    return( mMissed );
+}
@@ -0,0 +1,45 @@
+/*******************************************************************************
+ *  pacer.h
+ *
+ *  This is the header file for the frame pacer class, defined in pacer.cpp.
+ *
+*******************************************************************************/
+#ifndef CLASS_PACER_H
+#define CLASS_PACER_H
+
+/*
+ *  The FramePacer class
+ */
+class FramePacer
+{
+    public:
+        /*  Constructor */
+        FramePacer( void );
+
+        /*  Destructor */
+        ~FramePacer( void );
+
+        /*  Set the target frame rate */
+        void set_rate( unsigned int fps );
+
+        /*  Wait until it's time for the next frame */
+        void wait( void );
+
+        /*  Frame counts */
+        Uint64 get_frames( void );
+        Uint64 get_missed( void );
+
+    private:
+        /*  Performance counter units per frame, and per millisecond */
+        Uint64 mFrameLength;
+        Uint64 mMillisecond;
+
+        /*  When the current frame is due */
+        Uint64 mDeadline;
+
+        /*  Frames paced, and how many of them were late */
+        Uint64 mFrames;
+        Uint64 mMissed;
+};
+
+#endif
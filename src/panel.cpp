@@ -25,8 +25,6 @@ Panel::Panel( void )
     /*  Null texture object pointers */
     mTextureBackground = NULL;
     mTextureButtons = NULL;
-    mScoreTexture = NULL;
-    mHighScoreTexture = NULL;
 }
 
 
@@ -44,8 +42,6 @@ Panel::~Panel( void )
      */
     mTextureBackground = NULL;
     mTextureButtons = NULL;
-    mScoreTexture = NULL;
-    mHighScoreTexture = NULL;
 }
 
 
@@ -85,24 +81,6 @@ void Panel::init_layout( void )
 
 
 
-/*
---------------------------------------------------------------------------------
-                                     LAYOUT
---------------------------------------------------------------------------------
- *  Set the positions of the score textures according to both their relative
- *  positions on the panel and the absolute position of the panel itself.
-*/
-void Panel::layout( void )
-{
-    /*  Current score position */
-    mScoreTexture->set_position( mPos.x + mScorePos.x, mPos.y + mScorePos.y );
-
-    /*  Current high score */
-    mHighScoreTexture->set_position( mPos.x + mHighScorePos.x,
-            mPos.y + mHighScorePos.y );
-}
-
-
 /*
 --------------------------------------------------------------------------------
                               SET / GET DIMENSIONS
@@ -171,16 +149,6 @@ void Panel::set_panel_texture_buttons( Texture *texture )
     mTextureButtons = texture;
 }
 
-void Panel::set_score_texture_object( Texture *texture )
-{
-    mScoreTexture = texture;
-}
-
-void Panel::set_high_score_texture_object( Texture *texture )
-{
-    mHighScoreTexture = texture;
-}
-
 
 
 /*
@@ -204,11 +172,11 @@ void Panel::set_rect( int x, int y )
                                      RENDER
 --------------------------------------------------------------------------------
 */
-void Panel::render( void )
+void Panel::render( int lives, int charge )
 {
     /*  These are used for button displays on the panel */
-    int livesCount = player.get_lives();
-    int chargeCount = player.get_charge();
+    int livesCount = lives;
+    int chargeCount = charge;
 
     /*  Render the background */
     mTextureBackground->render( mPos.x, mPos.y, mWidth, mHeight );
@@ -277,7 +245,9 @@ void Panel::render( void )
         }
     }
 
-    /*  -----------------       TEXT TEXTURES   --------------------- */
-    scoreText->render_self();
-    highScoreText->render_self();
+    /*  -----------------       SCORE TEXT      --------------------- */
+    gFontTinyAtlas->render( currentScoreString, mPos.x + mScorePos.x,
+            mPos.y + mScorePos.y, colors[ COLOR_WHITE ] );
+    gFontTinyAtlas->render( highScoreString, mPos.x + mHighScorePos.x,
+            mPos.y + mHighScorePos.y, colors[ COLOR_WHITE ] );
 }
@@ -50,7 +50,6 @@ class Panel
 
         /*  Lay out the panel */
         void init_layout( void );
-        void layout( void );
 
         /*  Set / get dimensions */
         void set_width( int width );
@@ -69,11 +68,9 @@ class Panel
         /*  Set texture object */
         void set_panel_texture_background( Texture *texture );
         void set_panel_texture_buttons( Texture *texture );
-        void set_score_texture_object( Texture *texture );
-        void set_high_score_texture_object( Texture *texture );
 
-        /*  Render */
-        void render( void );
+        /*  Render, showing the given number of lives and charge */
+        void render( int lives, int charge );
 
 
     private:
@@ -98,8 +95,6 @@ class Panel
         /*  The texture object pointers */
         Texture *mTextureBackground;
         Texture *mTextureButtons;
-        Texture *mScoreTexture;
-        Texture *mHighScoreTexture;
 };
 
 #endif
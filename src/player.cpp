@@ -95,6 +95,7 @@ void Player::reset_stats( void )
     mPoweringDown = false;      //  This doesn't need to be true right now
     mInvulnerable = true;       //  Temporary invulnerability is switch on
     mExploding = false;         //  They don't start off exploding
+    mDebris = -1;               //  So they've got no debris either
 }
 
 
@@ -113,7 +114,7 @@ void Player::increment_lives( void )
         ++mLives;
 
         /*  Play the 'extra life' sound effect */
-        Mix_PlayChannel( -1, soundEffectExtraLife, 0 );
+        play_sound( soundEffectExtraLife );
     }
 }
 
@@ -150,13 +151,14 @@ void Player::check_bounds( void )
  *  called directly from the main events loop; other player actions (honking,
  *  etc.) are handled there as well.
 */
-void Player::move_mouse( void )
+void Player::move_mouse( int x, int y )
 {
     /*
      *  We just store the current mouse position directly into the player's
      *  current position.
      */
-    SDL_GetMouseState( &mPos.x, &mPos.y );
+    mPos.x = x;
+    mPos.y = y;
 
     /*  Check bounds to make sure we're cool, man */
     check_bounds();
@@ -202,16 +204,13 @@ void Player::move_velocity( void )
 --------------------------------------------------------------------------------
  *  This function is called from outside the event polling loop to prevent
  *  input delays.  It adjusts the player's current velocity according to the
- *  input read from SDL_GetKeyboardState().
+ *  arrow keys held down this tick.
 */
-void Player::move_keyboard( void )
+void Player::move_keyboard( Uint8 keys )
 {
-    /*  Get a state of all keys current being pressed */
-    const Uint8 *state = SDL_GetKeyboardState( NULL );
-
     /*  ----------------    HORIZONTAL VELOCITY --------------- */
     /*  Left key */
-    if( state[ SDL_SCANCODE_LEFT ] )
+    if( keys & INPUT_KEY_LEFT )
     {
         if( mVelocity.x > mMidVelocity )
             mVelocity.x = mMidVelocity;
@@ -220,7 +219,7 @@ void Player::move_keyboard( void )
     }
 
     /*  Right key */
-    else if( state[ SDL_SCANCODE_RIGHT ] )
+    else if( keys & INPUT_KEY_RIGHT )
     {
         if( mVelocity.x < mMidVelocity )
             mVelocity.x = mMidVelocity;
@@ -236,7 +235,7 @@ void Player::move_keyboard( void )
 
     /*  ----------------    VERTICAL VELOCITY ------------------ */
     /*  Up key */
-    if( state[ SDL_SCANCODE_UP ] )
+    if( keys & INPUT_KEY_UP )
     {
         if( mVelocity.y > mMidVelocity )
             mVelocity.y = mMidVelocity;
@@ -245,7 +244,7 @@ void Player::move_keyboard( void )
     }
 
     /*  Down key */
-    else if( state[ SDL_SCANCODE_DOWN ] )
+    else if( keys & INPUT_KEY_DOWN )
     {
         if( mVelocity.y < mMidVelocity )
             mVelocity.y = mMidVelocity;
@@ -269,12 +268,30 @@ void Player::move_keyboard( void )
 --------------------------------------------------------------------------------
                                      UPDATE
 --------------------------------------------------------------------------------
- *  All the update function does is keep the honking bool in line.
+ *  The update function keeps the honking bool in line, counts down the
+ *  temporary invulnerability after a respawn and moves the explosion debris
+ *  along while the player is blowing up.
 */
 void Player::update( void )
 {
     if( mHonking )
         mHonking = false;
+
+    /*  Respawn invulnerability lasts for 180 ticks (3 seconds) */
+    if( mAlive && mInvulnerable )
+    {
+        ++mInvulnerableTicks;
+
+        if( mInvulnerableTicks > 180 )
+        {
+            mInvulnerable = false;
+            mInvulnerableTicks = 0;
+        }
+    }
+
+    /*  See if the debris is done if we're exploding */
+    if( mExploding )
+        update_exploding();
 }
 
 
@@ -294,10 +311,10 @@ void Player::kill( void )
     init_explosion();
 
     /*  Make the screen flash */
-    screenFlash = true;
+    ++screenFlashes;
 
     /*  Play the explosion sound effect */
-    Mix_PlayChannel( -1, soundEffectExplosion, 0 );
+    play_sound( soundEffectExplosion );
 
     /*  Set the current charge to zero */
     mCharge = 0;
@@ -327,8 +344,7 @@ void Player::render( void )
             render_alive();
     }
 
-    else if( mExploding )
-        render_exploding();
+    /*  If we're exploding, the debris gets drawn along with everyone else's */
 }
 
 
@@ -340,7 +356,12 @@ void Player::render( void )
 */
 void Player::render_alive( void )
 {
-    mTextureObject->render( mPos.x, mPos.y, mWidth, mHeight, &mClips[ mFrame ]);
+    /*  Make sure we don't get stuck on an 'off' flash */
+    if( ! mInvulnerable )
+        mTextureObject->mod_alpha( 255 );
+
+    mTextureObject->render( mPos.x, mPos.y, mWidth, mHeight,
+            mSheet->get_clip( mFrame ) );
 }
 
 
@@ -354,19 +375,11 @@ void Player::render_alive( void )
 */
 void Player::render_invulnerable( void )
 {
-    ++mInvulnerableTicks;
-
     if( mInvulnerableTicks % 4 == 0 )
         mTextureObject->mod_alpha( 0 );
     else
         mTextureObject->mod_alpha( 255 );
 
-    if( mInvulnerableTicks > 180 )
-    {
-        mInvulnerable = false;
-        mInvulnerableTicks = 0;
-    }
-
     render_alive();
 }
 
@@ -399,19 +412,14 @@ void Player::set_invulnerable( bool invulnerable )
  *  ship texture by moving back along the clip array.  If he's moving right,
  *  move down the texture by moving foward along the clip array.
  *
- *  Basically, it tilts the ship left or right.
+ *  Basically, it tilts the ship left or right.  The change is this tick's
+ *  relative mouse motion along the X axis.
  *
  *  It might be helpful to mention that the player texture is one long, vertical
  *  sprite sheet, 30 rows, 1 column.
 */
-void Player::tilt( void )
+void Player::tilt( int change )
 {
-    /*  We'll store the relative mouse motion here */
-    int change = 0;
-
-    /*  DO IT TO IT */
-    SDL_GetRelativeMouseState( &change, NULL );
-
     /*  Also check for 'keyboard' velocity */
     if( mVelocity.x < 0 )
         change = -1;
@@ -497,12 +505,12 @@ void Player::increment_charge( void )
         if( mCharge == mMaxCharge && mChargeFull == false )
         {
             mChargeFull = true;
-            Mix_PlayChannel( -1, soundEffectDing, 0 );
+            play_sound( soundEffectDing );
         }
 
         /*  If it isn't full, just play a 'tick' sound */
         else
-            Mix_PlayChannel( -1, soundEffectTick, 0 );
+            play_sound( soundEffectTick );
     }
 
 }
@@ -558,14 +566,14 @@ void Player::init_power( void )
             tail.start_tail();
 
             /*  Engine spool up sound effect */
-            mChannel = Mix_PlayChannel( -1, soundEffectEngineUp, 0 );
+            mChannel = play_sound( soundEffectEngineUp );
         }
 
         /*  If not enough charge, just play an 'engine fail' sound effect */
         else
         {
             /*  Engine fail sound effect */
-            mChannel = Mix_PlayChannel( -1, soundEffectEngineFail, 0 );
+            mChannel = play_sound( soundEffectEngineFail );
         }
     }
 }
@@ -673,11 +681,11 @@ void Player::power_update( void )
         if( ! mPoweringDown )
         {
             /*  If the spool up sound effect is playing, stop it */
-            if( Mix_Playing( mChannel ) == 1 )
+            if( mChannel >= 0 && Mix_Playing( mChannel ) == 1 )
                 Mix_HaltChannel( mChannel );
 
             /*  Play the spool down sound effect */
-            Mix_PlayChannel( mChannel, soundEffectEngineDown, 0 );
+            play_sound( soundEffectEngineDown, mChannel );
 
             mPoweringDown = true;
         }
@@ -732,7 +740,7 @@ void Player::honk( void )
         /*  Set honking status */
         mHonking = true;
 
-        Mix_PlayChannel( -1, soundEffectHonk, 0 );
+        play_sound( soundEffectHonk );
     }
 }
 
@@ -29,10 +29,10 @@ class Player : public Ship
         void increment_charge( void );
 
         /*  Move the player's ship to where the mouse is */
-        void move_mouse( void );
+        void move_mouse( int x, int y );
 
-        /*  Move player's ship using keyboard controls */
-        void move_keyboard( void );
+        /*  Move player's ship using keyboard controls (INPUT_KEY_* bits) */
+        void move_keyboard( Uint8 keys );
 
         /*  Movement according to velocity */
         void move_velocity( void );
@@ -56,7 +56,7 @@ class Player : public Ship
         void set_invulnerable( bool invulnerable );
 
         /*  Moving left / right */
-        void tilt( void );
+        void tilt( int change );
 
         /*  Set special texture */
         void set_special_texture_object( Texture *texture );
@@ -0,0 +1,280 @@
+/*******************************************************************************
+ *  profiler.cpp
+ *
+ *  This file defines the profiler class, which keeps track of how long each
+ *  phase of a frame takes.  It can show rolling averages and maximums in an
+ *  overlay (F3 during play) and write every frame's times out to a CSV file
+ *  (--profile-out FILE).
+ *
+ *  Only builds made with -DPROFILING time anything or open the CSV file.
+ *  Every build still closes it on the way out, which does nothing if it was
+ *  never opened.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*  Names of the phases, used for the CSV header and the overlay */
+static const char *phaseNames[ TOTAL_PROFILE_PHASES ] =
+{
+    "frame",
+    "events",
+    "update",
+    "spawn",
+    "enemies",
+    "broadphase",
+    "collisions",
+    "cleanup",
+    "starfield",
+    "explosions",
+    "kisskills",
+    "render",
+    "r_starfield",
+    "r_ships",
+    "r_explosions",
+    "r_panel",
+    "r_kisskills",
+    "r_osd",
+    "present"
+};
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                  CONSTRUCTOR
+--------------------------------------------------------------------------------
+*/
+Profiler::Profiler( void )
+{
+    for( int i = 0; i < TOTAL_PROFILE_PHASES; ++i )
+    {
+        mCurrent[ i ] = 0;
+        mOverlayLines[ i ][ 0 ] = '\0';
+
+        for( int h = 0; h < PROFILE_WINDOW; ++h )
+            mHistory[ i ][ h ] = 0.0f;
+    }
+
+    mHistoryPos = 0;
+    mHistoryCount = 0;
+    mThread = 0;
+    mFrameStart = 0;
+    mFrames = 0;
+    mCountsToMs = 0.0;
+    mCSV = NULL;
+    mOverlay = false;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   DESTRUCTOR
+--------------------------------------------------------------------------------
+*/
+Profiler::~Profiler( void )
+{
+    close_csv();
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                OPEN / CLOSE CSV
+--------------------------------------------------------------------------------
+ *  Open the CSV file and write its header.  Times are in milliseconds.
+*/
+bool Profiler::open_csv( const char *path )
+{
+    close_csv();
+
+    mCSV = fopen( path, "w" );
+    if( mCSV == NULL )
+    {
+        printf("ERROR:  Could not open profile output file %s\n", path );
+        return( false );
+    }
+
+    fprintf( mCSV, "frame" );
+    for( int i = 0; i < TOTAL_PROFILE_PHASES; ++i )
+        fprintf( mCSV, ",%s_ms", phaseNames[ i ] );
+    fprintf( mCSV, "\n" );
+
+    return( true );
+}
+
+void Profiler::close_csv( void )
+{
+    if( mCSV != NULL )
+    {
+        fclose( mCSV );
+        mCSV = NULL;
+    }
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                  BEGIN FRAME
+--------------------------------------------------------------------------------
+*/
+void Profiler::begin_frame( void )
+{
+    if( mCountsToMs == 0.0 )
+        mCountsToMs = 1000.0 / (double)SDL_GetPerformanceFrequency();
+
+    mThread = SDL_ThreadID();
+    mFrameStart = SDL_GetPerformanceCounter();
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   END FRAME
+--------------------------------------------------------------------------------
+ *  Close out the frame:  store its times in the history, write them to the
+ *  CSV file if there is one, and refresh the overlay every half second.
+*/
+void Profiler::end_frame( void )
+{
+    mCurrent[ PROF_FRAME ] = SDL_GetPerformanceCounter() - mFrameStart;
+
+    if( mCSV != NULL )
+        fprintf( mCSV, "%llu", (unsigned long long)mFrames );
+
+    for( int i = 0; i < TOTAL_PROFILE_PHASES; ++i )
+    {
+        float ms = (float)( mCurrent[ i ] * mCountsToMs );
+        mHistory[ i ][ mHistoryPos ] = ms;
+
+        if( mCSV != NULL )
+            fprintf( mCSV, ",%.4f", ms );
+
+        mCurrent[ i ] = 0;
+    }
+
+    if( mCSV != NULL )
+        fprintf( mCSV, "\n" );
+
+    /*  Move along the history ring */
+    mHistoryPos = ( mHistoryPos + 1 ) % PROFILE_WINDOW;
+    if( mHistoryCount < PROFILE_WINDOW )
+        ++mHistoryCount;
+
+    ++mFrames;
+
+    if( mOverlay && mFrames % 30 == 0 )
+        update_overlay();
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                    GET LAST
+--------------------------------------------------------------------------------
+*/
+float Profiler::get_last( int phase )
+{
+    if( mHistoryCount == 0 )
+        return( 0.0f );
+
+    return( mHistory[ phase ][ ( mHistoryPos + PROFILE_WINDOW - 1 ) %
+            PROFILE_WINDOW ] );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                 GET PHASE NAME
+--------------------------------------------------------------------------------
+*/
+const char* Profiler::get_phase_name( int phase )
+{
+    return( phaseNames[ phase ] );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                 TOGGLE OVERLAY
+--------------------------------------------------------------------------------
+*/
+void Profiler::toggle_overlay( void )
+{
+    mOverlay = ! mOverlay;
+
+    if( mOverlay )
+        update_overlay();
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                 UPDATE OVERLAY
+--------------------------------------------------------------------------------
+ *  Work out the averages and maximums over the history and turn them into
+ *  text.  This only happens every so often, so the numbers can be read.
+*/
+void Profiler::update_overlay( void )
+{
+    for( int i = 0; i < TOTAL_PROFILE_PHASES; ++i )
+    {
+        float total = 0.0f;
+        float max = 0.0f;
+
+        for( int h = 0; h < mHistoryCount; ++h )
+        {
+            total += mHistory[ i ][ h ];
+            if( mHistory[ i ][ h ] > max )
+                max = mHistory[ i ][ h ];
+        }
+
+        float avg = mHistoryCount > 0 ? total / mHistoryCount : 0.0f;
+        snprintf( mOverlayLines[ i ], sizeof( mOverlayLines[ i ] ),
+                "%-12s %6.2f %6.2f", phaseNames[ i ], avg, max );
+    }
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                     RENDER
+--------------------------------------------------------------------------------
+ *  Draw the overlay in the top left corner:  one line per phase, showing
+ *  average and maximum milliseconds over the last PROFILE_WINDOW frames.
+*/
+void Profiler::render( void )
+{
+    if( ! mOverlay || gFontTinyAtlas == NULL ||
+            mOverlayLines[ 0 ][ 0 ] == '\0' )
+        return;
+
+    int lineHeight = gFontTinyAtlas->get_height() + 2;
+
+    /*  Darken the area behind the text so it can actually be read */
+    SDL_Rect bg = { 0, 0,
+        gFontTinyAtlas->get_text_width( mOverlayLines[ 0 ] ) + 20,
+        lineHeight * TOTAL_PROFILE_PHASES + 20 };
+    SDL_SetRenderDrawColor( gRenderer, 0, 0, 0, 191 );
+    SDL_RenderFillRect( gRenderer, &bg );
+
+    for( int i = 0; i < TOTAL_PROFILE_PHASES; ++i )
+    {
+        gFontTinyAtlas->render( mOverlayLines[ i ], 10,
+                10 + ( lineHeight * i ), colors[ COLOR_GREEN ] );
+    }
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                             PROFILE TIMER DESTRUCTOR
+--------------------------------------------------------------------------------
+ *  The timer's scope is over, so add its time to its phase
+*/
+ProfileTimer::~ProfileTimer( void )
+{
+    profiler.add( mPhase, SDL_GetPerformanceCounter() - mStart );
+}
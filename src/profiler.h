@@ -0,0 +1,150 @@
+/*******************************************************************************
+ *  profiler.h
+ *
+ *  This is the header file for the profiler class, defined in profiler.cpp,
+ *  as well as the PROFILE_* macros used to time the different phases of a
+ *  frame.
+ *
+ *  The macros only do anything when the game is built with -DPROFILING (see
+ *  'make profile'); otherwise they compile to nothing at all.
+ *
+*******************************************************************************/
+#ifndef CLASS_PROFILER_H
+#define CLASS_PROFILER_H
+
+/*  Number of frames the overlay's averages and maximums are taken over */
+#define PROFILE_WINDOW 120
+
+/*  The phases of a frame we keep track of */
+enum profilePhases
+{
+    PROF_FRAME,                 //  The whole frame
+    PROF_EVENTS,                //  handle_events()
+    PROF_UPDATE,                //  All of the ticks run this frame
+    PROF_SPAWN,                 //  Spawning enemies
+    PROF_ENEMIES,               //  Enemy loop (includes collisions)
+    PROF_BROADPHASE,            //  Building and querying the enemy grid
+    PROF_COLLISIONS,            //  Player / enemy collision checks
+    PROF_CLEANUP,               //  Erasing enemies that are gone
+    PROF_STARFIELD,             //  Starfield update
+    PROF_EXPLOSIONS,            //  'Atari' explosions update
+    PROF_KISSKILLS,             //  Kiss/kill OSDs update
+    PROF_RENDER,                //  render()
+    PROF_RENDER_STARFIELD,      //  Starfield render
+    PROF_RENDER_SHIPS,          //  Player, tail and enemies render
+    PROF_RENDER_EXPLOSIONS,     //  'Atari' explosions render
+    PROF_RENDER_PANEL,          //  Panel render
+    PROF_RENDER_KISSKILLS,      //  Kiss/kill OSDs render
+    PROF_RENDER_OSD,            //  Border and OSD render
+    PROF_PRESENT,               //  SDL_RenderPresent()
+    TOTAL_PROFILE_PHASES
+};
+
+/*
+ *  The Profiler class
+ */
+class Profiler
+{
+    public:
+        /*  Constructor */
+        Profiler( void );
+
+        /*  Destructor */
+        ~Profiler( void );
+
+        /*  Open / close the per-frame CSV file */
+        bool open_csv( const char *path );
+        void close_csv( void );
+
+        /*  Mark the beginning and end of a frame */
+        void begin_frame( void );
+        void end_frame( void );
+
+        /*
+         *  Add time (in performance counter units) to the given phase.  Only
+         *  the thread running the frames counts; in threaded mode the ticks
+         *  happen elsewhere and aren't included.
+         */
+        void add( int phase, Uint64 counts )
+        {
+            if( SDL_ThreadID() == mThread )
+                mCurrent[ phase ] += counts;
+        }
+
+        /*  Milliseconds spent in a phase during the last finished frame */
+        float get_last( int phase );
+
+        /*  Short name of a phase */
+        static const char* get_phase_name( int phase );
+
+        /*  Show or hide the overlay */
+        void toggle_overlay( void );
+
+        /*  Render the overlay, if it's showing */
+        void render( void );
+
+    private:
+        /*  Format the overlay's lines of text */
+        void update_overlay( void );
+
+        /*  Time spent in each phase this frame */
+        Uint64 mCurrent[ TOTAL_PROFILE_PHASES ];
+
+        /*  The last PROFILE_WINDOW frames' worth of times, in milliseconds */
+        float mHistory[ TOTAL_PROFILE_PHASES ][ PROFILE_WINDOW ];
+        int mHistoryPos;
+        int mHistoryCount;
+
+        /*  Thread the frames are run on */
+        SDL_threadID mThread;
+
+        /*  Counter values for the frame */
+        Uint64 mFrameStart;
+        Uint64 mFrames;
+        double mCountsToMs;
+
+        /*  CSV output */
+        FILE *mCSV;
+
+        /*  Overlay */
+        bool mOverlay;
+        char mOverlayLines[ TOTAL_PROFILE_PHASES ][ 64 ];
+};
+
+/*
+ *  Times the rest of the enclosing scope and adds it to the given phase
+ */
+class ProfileTimer
+{
+    public:
+        ProfileTimer( int phase )
+        {
+            mPhase = phase;
+            mStart = SDL_GetPerformanceCounter();
+        }
+
+        ~ProfileTimer( void );
+
+    private:
+        int mPhase;
+        Uint64 mStart;
+};
+
+
+/*  The macros everything else actually uses */
+#ifdef PROFILING
+#define PROFILE_CONCAT2( a, b ) a##b
+#define PROFILE_CONCAT( a, b ) PROFILE_CONCAT2( a, b )
+#define PROFILE_SCOPE( phase ) \
+    ProfileTimer PROFILE_CONCAT( profileTimer, __LINE__ )( phase )
+#define PROFILE_BEGIN_FRAME() profiler.begin_frame()
+#define PROFILE_END_FRAME() profiler.end_frame()
+#define PROFILE_RENDER() profiler.render()
+#else
+#define PROFILE_SCOPE( phase )
+#define PROFILE_BEGIN_FRAME()
+#define PROFILE_END_FRAME()
+#define PROFILE_RENDER()
+#endif
+
+#endif
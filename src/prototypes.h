@@ -25,6 +25,15 @@ int check_args( int argc, char *argv[] );
 /*  Init all SDL stuff - defined in init.cpp */
 extern bool init( void );
 
+/*  Fill in the global colors array - defined in init.cpp */
+extern void init_colors( void );
+
+/*  Init the bare minimum for headless mode - defined in init.cpp */
+extern bool init_headless( void );
+
+/*  Seed all of the random number streams - defined in random.cpp */
+extern void seed_random( Uint64 seed );
+
 /*  Handle all events - defined in events.cpp */
 extern void handle_events( SDL_Event &e );
 
@@ -37,6 +46,9 @@ extern void render_menu( void );
 /*  Handles main screen rendering - defined in render.cpp */
 extern void render_main( void );
 
+/*  Don't show any screen flash asked for so far - defined in render.cpp */
+extern void skip_screen_flash( void );
+
 /*  Render the game over screen - defined in render.cpp */
 extern void render_game_over( void );
 
@@ -83,14 +95,23 @@ extern void render_help( void );
 extern void render_credits( void );
 
 /*  Draw a border around the player's boundary - defined in border.cpp */
-extern void draw_border( void );
+extern void draw_border( SDL_Color *c );
 
 /*  Closes out SDL and gets rid of objects - defined in close.cpp */
 extern void close( void );
 
+/*  Closes out headless mode - defined in close.cpp */
+extern void close_headless( void );
+
+/*  Loads the ship and asteroid sprite sheets - defined in load.cpp */
+extern bool load_sprite_sheets( void );
+
 /*  Loads all media for the game - defined in load.cpp */
 extern bool load_media( void );
 
+/*  Loads the sprite sheets needed by headless mode - defined in load.cpp */
+extern bool load_headless_media( void );
+
 /*  Load panel object - defined in load.cpp */
 extern void load_panel( void );
 
@@ -129,7 +150,15 @@ extern bool check_collision_box( SDL_Rect &rectA, SDL_Rect &rectB );
 
 /*  Check for per-pixel collisions - defined in collision.cpp */
 extern bool check_collision_colliders( std::vector<Collider> &collidersA,
-        std::vector<Collider> &collidersB );
+        int xA, int yA, std::vector<Collider> &collidersB, int xB, int yB );
+
+/*  Check for per-pixel collisions between masks - defined in collision.cpp */
+extern bool check_collision_masks( PixelMask &maskA, int xA, int yA,
+        PixelMask &maskB, int xB, int yB );
+
+/*  Same, with the second mask moving straight up or down - collision.cpp */
+extern bool check_collision_mask_sweep( PixelMask &maskA, int xA, int yA,
+        PixelMask &maskB, int xB, int yFrom, int yTo );
 
 /*  Checks for collision between a rectangle and a circle - collision.cpp */
 extern bool check_collision_rect_circ( SDL_Rect &rect, Circle &circ );
@@ -160,9 +189,44 @@ extern void reset( void );
 /*  Game over initialization - defined in gameover.cpp */
 extern void game_over( void );
 
+/*  Start / stop recording or playing back input - defined in replay.cpp */
+extern bool start_recording( const char *path );
+extern bool start_replay( const char *path );
+extern void stop_replay( void );
+
+/*  Get this tick's gameplay input - defined in replay.cpp */
+extern bool get_tick_input( InputFrame &input );
+
+/*  Run the simulation with no window, sound, etc. - defined in headless.cpp */
+extern int run_headless( void );
+
+/*  Record a finished headless game and start another - headless.cpp */
+extern void headless_game_over( void );
+
+/*  Simulate and render on separate threads - defined in simthread.cpp */
+extern bool run_threaded( FramePacer &pacer );
+
+/*  Put off a game over on the simulation thread - defined in simthread.cpp */
+extern bool defer_game_over( void );
+
+/*  The newest snapshot for the renderer - defined in simthread.cpp */
+extern WorldSnapshot* get_latest_snapshot( void );
+
+/*  A view of the live game world - defined in snapshot.cpp */
+extern WorldView get_live_view( void );
+
+/*  Record one tick / frame of a stress test - defined in stress.cpp */
+extern void stress_sample( Uint64 counts, WorldView &view );
+
+/*  Print the stress test results - defined in stress.cpp */
+extern void stress_report( void );
+
 /*  Enter high score initialization - defined in enterhighscore.cpp */
 extern void enter_high_score( void );
 
+/*  Play a sound effect, returning its channel - defined in sounds.cpp */
+extern int play_sound( Mix_Chunk *chunk, int channel = -1 );
+
 /*  Toggle all sounds on / off - defined in sounds.cpp */
 extern void toggle_sounds( void );
 
@@ -172,6 +236,9 @@ extern void toggle_music( void );
 /*  Mute or unmute everything - defined in sounds.cpp */
 extern void mute( bool muting );
 
+/*  Clear out the OSD text - defined in osd.cpp */
+extern void free_osd( void );
+
 /*  Create an OSD to display - defined in osd.cpp */
 extern void osd( const char *string );
 
@@ -179,6 +246,6 @@ extern void osd( const char *string );
 extern void update_osd( void );
 
 /*  Render the OSD if it exists - defined in osd.cpp */
-extern void render_osd( void );
+extern void render_osd( Uint8 alpha );
 
 #endif
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *  random.cpp
+ *
+ *  This file defines the random class, a small xoshiro128** pseudo-random
+ *  number generator, as well as the function that seeds all of the game's
+ *  random number streams.  It replaces rand(), which is slow, shared by
+ *  everything, and not something we can reproduce a run from.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*
+--------------------------------------------------------------------------------
+                                    SPLITMIX
+--------------------------------------------------------------------------------
+ *  Used to spread a single seed value out over the generator state.  Steps
+ *  the given value and returns the next output.
+*/
+static Uint64 splitmix( Uint64 &x )
+{
+    Uint64 z = ( x += 0x9E3779B97F4A7C15ULL );
+    z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+    z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBULL;
+
+    return( z ^ ( z >> 31 ) );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                  CONSTRUCTOR
+--------------------------------------------------------------------------------
+*/
+Random::Random( void )
+{
+    seed( 0 );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   DESTRUCTOR
+--------------------------------------------------------------------------------
+*/
+Random::~Random( void )
+{
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      SEED
+--------------------------------------------------------------------------------
+ *  Seed the generator.  Any seed is fine, including zero; splitmix makes sure
+ *  we never end up with the all-zero state xoshiro can't get out of.
+*/
+void Random::seed( Uint64 seed )
+{
+    Uint64 a = splitmix( seed );
+    Uint64 b = splitmix( seed );
+
+    mState[ 0 ] = (Uint32)a;
+    mState[ 1 ] = (Uint32)( a >> 32 );
+    mState[ 2 ] = (Uint32)b;
+    mState[ 3 ] = (Uint32)( b >> 32 );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      FILL
+--------------------------------------------------------------------------------
+ *  Fill a buffer with raw values.  This keeps the state in registers for the
+ *  whole run, which is a good bit faster than calling next() in a loop that
+ *  also does other work.
+*/
+void Random::fill( Uint32 *buffer, int count )
+{
+    Uint32 s0 = mState[ 0 ];
+    Uint32 s1 = mState[ 1 ];
+    Uint32 s2 = mState[ 2 ];
+    Uint32 s3 = mState[ 3 ];
+
+    for( int i = 0; i < count; ++i )
+    {
+        buffer[ i ] = rotl( s1 * 5, 7 ) * 9;
+
+        Uint32 t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = rotl( s3, 11 );
+    }
+
+    mState[ 0 ] = s0;
+    mState[ 1 ] = s1;
+    mState[ 2 ] = s2;
+    mState[ 3 ] = s3;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                  SEED RANDOM
+--------------------------------------------------------------------------------
+ *  Seed every stream from the one master seed.  Each stream gets a different
+ *  value run through splitmix, so they're all independent of one another.
+*/
+void seed_random( Uint64 seed )
+{
+    rngSeed = seed;
+
+    Uint64 s = seed;
+    for( int i = 0; i < TOTAL_RNG_STREAMS; ++i )
+        rng[ i ].seed( splitmix( s ) );
+}
@@ -0,0 +1,84 @@
+/*******************************************************************************
+ *  random.h
+ *
+ *  This is the header file for the random class, defined in random.cpp.
+ *
+ *  The handful of methods that get called per star / per particle every tick
+ *  are defined right here so they can be inlined.
+ *
+*******************************************************************************/
+#ifndef CLASS_RANDOM_H
+#define CLASS_RANDOM_H
+
+/*
+ *  The Random class, a xoshiro128** generator.  Each subsystem gets its own
+ *  instance (see the rngStreams enum) so that, say, explosion debris doesn't
+ *  change where the next asteroid shows up.
+ */
+class Random
+{
+    public:
+        /*  Constructor */
+        Random( void );
+
+        /*  Destructor */
+        ~Random( void );
+
+        /*  (Re)seed the generator */
+        void seed( Uint64 seed );
+
+        /*  Next raw 32-bit value */
+        Uint32 next( void )
+        {
+            Uint32 result = rotl( mState[ 1 ] * 5, 7 ) * 9;
+            Uint32 t = mState[ 1 ] << 9;
+
+            mState[ 2 ] ^= mState[ 0 ];
+            mState[ 3 ] ^= mState[ 1 ];
+            mState[ 1 ] ^= mState[ 2 ];
+            mState[ 0 ] ^= mState[ 3 ];
+            mState[ 2 ] ^= t;
+            mState[ 3 ] = rotl( mState[ 3 ], 11 );
+
+            return( result );
+        }
+
+        /*  Value from 0 to n - 1, for use in place of rand() % n */
+        int range( int n )
+        {
+            return( (int)( ( (Uint64)next() * (Uint32)n ) >> 32 ) );
+        }
+
+        /*  Either -1 or 1 */
+        int sign( void )
+        {
+            return( ( next() & 0x80000000 ) ? -1 : 1 );
+        }
+
+        /*  One in n chance of being true */
+        bool chance( int n )
+        {
+            return( next() < odds( n ) );
+        }
+
+        /*
+         *  Batch functions.  fill() writes count raw values to buffer; a value
+         *  from it is a one in n hit if it's below odds( n ).
+         */
+        void fill( Uint32 *buffer, int count );
+        static Uint32 odds( int n )
+        {
+            return( n <= 1 ? 0xFFFFFFFF : 0xFFFFFFFF / (Uint32)n );
+        }
+
+    private:
+        static Uint32 rotl( Uint32 x, int k )
+        {
+            return( ( x << k ) | ( x >> ( 32 - k ) ) );
+        }
+
+        /*  Generator state */
+        Uint32 mState[ 4 ];
+};
+
+#endif
@@ -11,46 +11,89 @@
 #endif
 
 
+/*  How many screen flashes have been shown (see render_world()) */
+static Uint32 shownFlashes = 0;
+
+
 /*
 --------------------------------------------------------------------------------
-                                  RENDER MAIN
+                               UPDATE SCORE TEXT
 --------------------------------------------------------------------------------
- *  This function renders everything on the main screen during play.
+ *  Remake the score string, but only when the score has actually changed.  The
+ *  panel draws it from the glyph atlas, so there's no texture to remake.
 */
-void render_main( void )
+static void update_score_text( Uint32 score )
 {
-    /*  Render the starfield */
-    starfield->render();
+    static Uint32 shownScore = 0;
+    static bool shown = false;
+
+    if( shown && score == shownScore )
+        return;
+
+    snprintf( currentScoreString, 9, "%06u", score );
+
+    shownScore = score;
+    shown = true;
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                               SKIP SCREEN FLASH
+--------------------------------------------------------------------------------
+ *  Count every flash asked for so far as shown, so none of them get drawn
+*/
+void skip_screen_flash( void )
+{
+    shownFlashes = screenFlashes;
+}
 
-    /*  Render the tail */
-    if( tail.is_active() || tail.is_fading() )
-        tail.render();
 
-    /*  Render the player's ship */
-    player.render();
 
-    /*  Render the enemies */
-    if( enemies.size() > 0 )
+/*
+--------------------------------------------------------------------------------
+                                  RENDER WORLD
+--------------------------------------------------------------------------------
+ *  This function renders everything on the main screen during play, from
+ *  whichever copy of the world it's given.
+ *
+ *  The screen flashes for one frame whenever the world's flash count has got
+ *  ahead of the flashes shown.  Going by the count rather than a flag means a
+ *  snapshot the renderer never got to doesn't lose its flash, and drawing the
+ *  same snapshot twice doesn't flash twice.
+*/
+static void render_world( WorldView &view )
+{
+    /*  Render the starfield */
     {
-        /*  Create the enemy iterator */
-        std::vector<Enemy>::iterator enemy;
+        PROFILE_SCOPE( PROF_RENDER_STARFIELD );
+        view.starfield->render();
+    }
 
-        /*  Iterate through the enemies vector */
-        for( enemy = enemies.begin(); enemy != enemies.end(); ++enemy )
-        {
-            /*  If they're alive, render them */
-            if( enemy->is_alive() )
-                enemy->render();
+    /*  Render the tail, the player, the enemies and whatever's exploded */
+    {
+        PROFILE_SCOPE( PROF_RENDER_SHIPS );
 
-            //  Otherwise, they must have been killed, so render the explosion
-            else if( enemy->is_exploding() )
-                enemy->render_exploding();
-        }
+        /*  Render the tail */
+        if( view.tail->is_active() || view.tail->is_fading() )
+            view.tail->render();
+
+        /*  Render the player's ship */
+        view.player->render();
+
+        /*  Render the enemies */
+        view.enemies->render();
+
+        /*  Render the debris from the player and the enemies */
+        view.debris->render();
     }
 
     /*  If the screen is flashing, render it */
-    if( screenFlash )
+    if( (Sint32)( view.screenFlashes - shownFlashes ) > 0 )
     {
+        shownFlashes = view.screenFlashes;
+
         /*  The flash is drawn over the entire play area */
         SDL_Rect rect = { 0, 0, BWIDTH, BHEIGHT };
 
@@ -59,31 +102,76 @@ void render_main( void )
 
         /*  Render it */
         SDL_RenderFillRect( gRenderer, &rect );
-
-        /*  Set it to false after rendering once */
-        screenFlash = false;
     }
 
     /*  Render the 'atari' explosions */
-    std::vector<AtariExplosion>::iterator a;
-    for( a = aExplosions.begin(); a != aExplosions.end(); ++a )
-        a->render();
+    {
+        PROFILE_SCOPE( PROF_RENDER_EXPLOSIONS );
+
+        for( size_t a = 0; a < view.aExplosions->size(); ++a )
+            ( *view.aExplosions )[ a ].render();
+    }
 
     /*  Render the panel */
-    panel.render();
+    {
+        PROFILE_SCOPE( PROF_RENDER_PANEL );
+        update_score_text( view.score );
+        panel.render( view.player->get_lives(), view.player->get_charge() );
+    }
 
     /*  Render kiss/kill text OSDs */
-    kissKills.render();
+    {
+        PROFILE_SCOPE( PROF_RENDER_KISSKILLS );
+        view.kissKills->render();
+    }
+
+    /*  Render the border and the OSD */
+    PROFILE_SCOPE( PROF_RENDER_OSD );
 
     /*
      *  If the player is in 'special' mode, render a color border around the
      *  screen
      */
-    if( player.is_powered() )
-        draw_border();
+    if( view.player->is_powered() )
+        draw_border( view.player->get_special_color() );
 
     /*  If the OSD exists, render it */
-    render_osd();
+    render_osd( view.osdAlpha );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                  RENDER MAIN
+--------------------------------------------------------------------------------
+ *  This function renders the main screen during play.  Normally that's
+ *  straight from the live game objects.  When the simulation has its own
+ *  thread, live play is drawn from the newest snapshot instead, and placed
+ *  between ticks by how long ago that snapshot was taken.
+*/
+void render_main( void )
+{
+    if( threaded && currentScreen == SCREEN_MAIN )
+    {
+        WorldSnapshot *snapshot = get_latest_snapshot();
+
+        /*  Nothing to draw until the first tick is in */
+        if( snapshot == NULL )
+            return;
+
+        Uint64 tickLength = SDL_GetPerformanceFrequency() / FPS;
+        Uint64 age = SDL_GetPerformanceCounter() - snapshot->get_time();
+        tickInterpolation = age >= tickLength ? 1.0f :
+            (float)age / (float)tickLength;
+
+        WorldView view = snapshot->get_view();
+        render_world( view );
+        return;
+    }
+
+    WorldView view = get_live_view();
+    render_world( view );
 }
 
 
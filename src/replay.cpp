@@ -0,0 +1,327 @@
+/*******************************************************************************
+ *  replay.cpp
+ *
+ *  This file defines input gathering for each simulation tick, along with the
+ *  recording and playback of that input.  Since everything random comes from
+ *  the seeded streams in random.cpp, the seed plus every tick's input is all
+ *  it takes to play a game back exactly as it happened.
+ *
+ *  A replay file is a header followed by one record per tick, all integers
+ *  little-endian so files move between machines:
+ *
+ *      Header  (16 bytes)
+ *          char[4]     "BLTR"
+ *          Uint8       Format version (see REPLAY_VERSION)
+ *          Uint64      Seed
+ *          Uint16      Stress test spawn multiplier (--stress, 1 if not)
+ *          Uint8       REPLAY_FLAG_* bits
+ *
+ *      Tick    (10 bytes)
+ *          Sint16      Mouse X
+ *          Sint16      Mouse Y
+ *          Sint16      Relative mouse X
+ *          Sint16      Relative mouse Y
+ *          Uint8       INPUT_* button bits
+ *          Uint8       INPUT_KEY_* key bits
+ *
+ *  The version goes up whenever the same header and input would stop playing
+ *  out the same game, and files of any other version are turned away rather
+ *  than left to drift out of sync:
+ *
+ *      1   The first format
+ *      2   Each debris cloud gets its own random stream
+ *      3   The header has --stress and --no-death, which playback restores
+ *      4   The player and asteroids collide by their exact pixels
+ *      5   Asteroids come in four sizes
+ *      6   Debris particles take fewer random numbers
+ *
+ *  A recording covers one game, from the start until game over.  Headless
+ *  runs have no input, but they still get an (empty) record for every tick,
+ *  so playing one back runs exactly the same game.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*  The replay file we're reading or writing */
+static FILE *replayFile = NULL;
+
+/*  Ticks read / written so far */
+static Uint32 replayTicks = 0;
+
+/*  Replay file format details */
+static const char REPLAY_MAGIC[ 4 ] = { 'B', 'L', 'T', 'R' };
+static const Uint8 REPLAY_VERSION = 6;
+
+/*  Header flags, for the options that change how the game plays */
+static const Uint8 REPLAY_FLAG_STRESS = 0x01;       //  --stress was given
+static const Uint8 REPLAY_FLAG_NO_DEATH = 0x02;     //  --no-death
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                 READ / WRITE
+--------------------------------------------------------------------------------
+ *  Little-endian helpers.  The reads return false if the file ran out.
+*/
+static void write_le( Uint64 value, int bytes )
+{
+    for( int i = 0; i < bytes; ++i )
+        fputc( (int)( ( value >> ( i * 8 ) ) & 0xFF ), replayFile );
+}
+
+static bool read_le( Uint64 *value, int bytes )
+{
+    *value = 0;
+
+    for( int i = 0; i < bytes; ++i )
+    {
+        int ch = fgetc( replayFile );
+        if( ch == EOF )
+            return( false );
+
+        *value |= (Uint64)ch << ( i * 8 );
+    }
+
+    return( true );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                START RECORDING
+--------------------------------------------------------------------------------
+ *  Open the replay file for writing and write the header.  If the user didn't
+ *  give us a seed, pick one now so it can go into the header.  The options
+ *  that change the game go in too, since it won't play out the same without
+ *  them.
+*/
+bool start_recording( const char *path )
+{
+    replayFile = fopen( path, "wb" );
+    if( replayFile == NULL )
+    {
+        printf("ERROR:  Could not open replay file %s for writing\n", path );
+        return( false );
+    }
+
+    if( ! seedGiven )
+    {
+        seed_random( (Uint64)time(NULL) );
+        seedGiven = true;
+    }
+
+    fwrite( REPLAY_MAGIC, 1, 4, replayFile );
+    write_le( REPLAY_VERSION, 1 );
+    write_le( rngSeed, 8 );
+
+    Uint8 flags = 0;
+    if( stress )
+        flags |= REPLAY_FLAG_STRESS;
+    if( noDeath )
+        flags |= REPLAY_FLAG_NO_DEATH;
+    write_le( (Uint16)stressFactor, 2 );
+    write_le( flags, 1 );
+
+    replayMode = REPLAY_RECORD;
+    replayTicks = 0;
+
+    return( true );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                  START REPLAY
+--------------------------------------------------------------------------------
+ *  Open a replay file, check its header, and seed the random streams and set
+ *  the game options from it (whatever was given on the command line)
+*/
+bool start_replay( const char *path )
+{
+    replayFile = fopen( path, "rb" );
+    if( replayFile == NULL )
+    {
+        printf("ERROR:  Could not open replay file %s\n", path );
+        return( false );
+    }
+
+    char magic[ 4 ];
+    Uint64 version = 0;
+    Uint64 seed = 0;
+    Uint64 factor = 1;
+    Uint64 flags = 0;
+
+    if( fread( magic, 1, 4, replayFile ) != 4 ||
+            memcmp( magic, REPLAY_MAGIC, 4 ) != 0 ||
+            ! read_le( &version, 1 ) )
+    {
+        printf("ERROR:  %s is not a replay file\n", path );
+        replayMode = REPLAY_OFF;
+        stop_replay();
+        return( false );
+    }
+
+    if( version != REPLAY_VERSION )
+    {
+        printf("ERROR:  Replay file version %u is not supported (this "
+                "build plays version %u)\n", (unsigned int)version,
+                (unsigned int)REPLAY_VERSION );
+        replayMode = REPLAY_OFF;
+        stop_replay();
+        return( false );
+    }
+
+    if( ! read_le( &seed, 8 ) || ! read_le( &factor, 2 ) ||
+            ! read_le( &flags, 1 ) || factor < 1 ||
+            factor > (Uint64)MAX_STRESS_FACTOR )
+    {
+        printf("ERROR:  %s has a broken header\n", path );
+        replayMode = REPLAY_OFF;
+        stop_replay();
+        return( false );
+    }
+
+    seed_random( seed );
+    seedGiven = true;
+
+    stressFactor = (int)factor;
+    stress = ( flags & REPLAY_FLAG_STRESS ) != 0;
+    noDeath = ( flags & REPLAY_FLAG_NO_DEATH ) != 0;
+
+    replayMode = REPLAY_PLAY;
+    replayTicks = 0;
+
+    return( true );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                  STOP REPLAY
+--------------------------------------------------------------------------------
+ *  Stop recording or replaying and close the file
+*/
+void stop_replay( void )
+{
+    if( replayFile != NULL )
+    {
+        fclose( replayFile );
+        replayFile = NULL;
+    }
+
+    if( replayMode == REPLAY_RECORD )
+        printf("Recorded %u ticks to %s\n", replayTicks, replayPath.c_str() );
+    else if( replayMode == REPLAY_PLAY )
+        printf("Replayed %u ticks from %s\n", replayTicks, replayPath.c_str() );
+
+    replayMode = REPLAY_OFF;
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                READ LIVE INPUT
+--------------------------------------------------------------------------------
+ *  Read the mouse, buttons and arrow keys from SDL
+*/
+static void read_live_input( InputFrame &input )
+{
+    /*  Mouse position and motion */
+    int x, y, relX, relY;
+    SDL_GetMouseState( &x, &y );
+    SDL_GetRelativeMouseState( &relX, &relY );
+    input.mouseX = (Sint16)x;
+    input.mouseY = (Sint16)y;
+    input.relX = (Sint16)relX;
+    input.relY = (Sint16)relY;
+
+    /*  Buttons pressed since the last tick */
+    input.buttons = pendingButtons;
+    pendingButtons = 0;
+
+    /*  Held arrow keys */
+    const Uint8 *state = SDL_GetKeyboardState( NULL );
+    if( state[ SDL_SCANCODE_LEFT ] )
+        input.keys |= INPUT_KEY_LEFT;
+    if( state[ SDL_SCANCODE_RIGHT ] )
+        input.keys |= INPUT_KEY_RIGHT;
+    if( state[ SDL_SCANCODE_UP ] )
+        input.keys |= INPUT_KEY_UP;
+    if( state[ SDL_SCANCODE_DOWN ] )
+        input.keys |= INPUT_KEY_DOWN;
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                 GET TICK INPUT
+--------------------------------------------------------------------------------
+ *  Fill in this tick's input.  When replaying it comes from the file;
+ *  otherwise it's read from SDL (and written to the file when recording).
+ *  Returns false if the replay file has run out, in which case the input is
+ *  left empty and playback is stopped.
+*/
+bool get_tick_input( InputFrame &input )
+{
+    input.mouseX = input.mouseY = input.relX = input.relY = 0;
+    input.buttons = input.keys = 0;
+
+    /*  Playback */
+    if( replayMode == REPLAY_PLAY )
+    {
+        Uint64 v[ 6 ];
+        for( int i = 0; i < 4; ++i )
+        {
+            if( ! read_le( &v[ i ], 2 ) )
+            {
+                stop_replay();
+                return( false );
+            }
+        }
+        if( ! read_le( &v[ 4 ], 1 ) || ! read_le( &v[ 5 ], 1 ) )
+        {
+            stop_replay();
+            return( false );
+        }
+
+        input.mouseX = (Sint16)v[ 0 ];
+        input.mouseY = (Sint16)v[ 1 ];
+        input.relX = (Sint16)v[ 2 ];
+        input.relY = (Sint16)v[ 3 ];
+        input.buttons = (Uint8)v[ 4 ];
+        input.keys = (Uint8)v[ 5 ];
+
+        /*  Anything the player is doing live doesn't count */
+        pendingButtons = 0;
+        ++replayTicks;
+
+        return( true );
+    }
+
+    /*  Live input (nobody's playing in headless mode, so it stays empty) */
+    if( ! headless )
+        read_live_input( input );
+
+    /*  Recording (headless too, so the tick count matches on playback) */
+    if( replayMode == REPLAY_RECORD )
+    {
+        write_le( (Uint16)input.mouseX, 2 );
+        write_le( (Uint16)input.mouseY, 2 );
+        write_le( (Uint16)input.relX, 2 );
+        write_le( (Uint16)input.relY, 2 );
+        write_le( input.buttons, 1 );
+        write_le( input.keys, 1 );
+        ++replayTicks;
+    }
+
+    return( true );
+}
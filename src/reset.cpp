@@ -15,8 +15,9 @@ void reset( void )
     /*  Reset player */
     player.reset_stats();
 
-    /*  Reset enemies */
+    /*  Reset enemies, and any explosions that are still going */
     enemies.clear();
+    debris.clear();
     enemyDelay = -90;
 
     /*  Reset scores */
@@ -25,11 +26,16 @@ void reset( void )
     extraLifeScore = 0;
 
     /*  Turn off the new flag on the high score screen */
-    gScores->set_new( false );
+    if( gScores != NULL )
+        gScores->set_new( false );
 
     /*  Stop the 'tail' */
     tail.stop_tail();
 
+    /*  There's no music to restart in headless mode */
+    if( headless )
+        return;
+
     /*  Stop the music */
     if( Mix_PlayingMusic() == 1 )
         Mix_HaltMusic();
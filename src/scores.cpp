@@ -484,11 +484,9 @@ void Scores::update( void )
     /*  Grab the highest score */
     mHighScore = mScores.begin()->score;
 
-    /*  Create the new high score text */
-    char newHighScore[ 16 ];
-    snprintf( newHighScore, 16, "%06u", mHighScore );
-    highScoreText->create_texture_from_string( gFontTiny, newHighScore,
-            colors[ COLOR_WHITE ] );
+    /*  Update the high score text */
+    snprintf( highScoreString, sizeof( highScoreString ), "%06u",
+            mHighScore );
 }
 
 
@@ -2,7 +2,8 @@
  *  ship.cpp
  *
  *  This file contains function definitions for the ship class, which is the
- *  parent class for both the player class and the enemy class.
+ *  parent class of the player class.  (The asteroids have a store of their
+ *  own; see asteroids.cpp.)
  *
 *******************************************************************************/
 #ifndef UTIL_H
@@ -17,11 +18,13 @@
 */
 Ship::Ship( void )
 {
-    /*  Null our pointer */
+    /*  Null our pointers */
     mTextureObject = NULL;
+    mSheet = NULL;
 
     /*  Set all of our whatevers to 0 */
     mWidth = mHeight = mPos.x = mPos.y = 0;
+    mPrevPos = mPos;
 
     /*  Set frames */
     mFrame = mMaxFrames = 0;
@@ -35,6 +38,7 @@ Ship::Ship( void )
     mLives = mDefaultLives;
     mMaxLives = 1;
     mExploding = false;
+    mDebris = -1;
 
     /*  By default, a ship is not initialized as a player ship */
     mPlayer = false;
@@ -70,6 +74,17 @@ void Ship::set_texture_object( Texture *texture )
 }
 
 
+/*
+--------------------------------------------------------------------------------
+                                SET SPRITE SHEET
+--------------------------------------------------------------------------------
+*/
+void Ship::set_sprite_sheet( SpriteSheet *sheet )
+{
+    mSheet = sheet;
+}
+
+
 /*
 --------------------------------------------------------------------------------
                               SET / GET DIMENSIONS
@@ -129,6 +144,9 @@ void Ship::set_position( int x, int y )
 {
     mPos.x = x;
     mPos.y = y;
+
+    /*  Placing a ship is a jump, not a movement, so there's nothing to blend */
+    mPrevPos = mPos;
 }
 
 int Ship::get_pos_x( void )
@@ -142,6 +160,28 @@ int Ship::get_pos_y( void )
 }
 
 
+
+/*
+--------------------------------------------------------------------------------
+                              GET RENDER POSITION
+--------------------------------------------------------------------------------
+ *  The simulation only moves things once per tick, but we may draw several
+ *  times in between (or skip a tick's worth of drawing altogether).  These
+ *  return the position blended between the previous and the current tick
+ *  according to tickInterpolation, so movement looks smooth at any refresh
+ *  rate.
+*/
+int Ship::get_render_x( void )
+{
+    return( mPrevPos.x + (int)( ( mPos.x - mPrevPos.x ) * tickInterpolation ) );
+}
+
+int Ship::get_render_y( void )
+{
+    return( mPrevPos.y + (int)( ( mPos.y - mPrevPos.y ) * tickInterpolation ) );
+}
+
+
 /*
 --------------------------------------------------------------------------------
                                      RENDER
@@ -149,7 +189,8 @@ int Ship::get_pos_y( void )
 */
 void Ship::render( void )
 {
-    mTextureObject->render( mPos.x, mPos.y, mWidth, mHeight, &mClips[ mFrame ]);
+    mTextureObject->render( get_render_x(), get_render_y(), mWidth, mHeight,
+            mSheet->get_clip( mFrame ) );
 }
 
 
@@ -203,43 +244,6 @@ int Ship::get_current_frame( void )
 
 
 
-/*
---------------------------------------------------------------------------------
-                                   INIT CLIPS
---------------------------------------------------------------------------------
- *  Initialize all of the clips for the ship's texture
-*/
-
-/*  -----   This function handles textures laid out with colums and rows */
-void Ship::init_clips( int rows, int columns, int width, int height )
-{
-    for( int r = 0; r < rows; ++r )
-    {
-        for( int c = 0; c < columns; ++c )
-        {
-            mClips[ ( r * columns ) + c ].x = c * width;
-            mClips[ ( r * columns ) + c ].y = r * height;
-            mClips[ ( r * columns ) + c ].w = width;
-            mClips[ ( r * columns ) + c ].h = height;
-        }
-    }
-}
-
-
-/*  --------    This function deals with 1-column, multi-row textures */
-void Ship::init_clips_vertical( int width, int height, int frames )
-{
-    for( int i = 0; i < frames; ++i )
-    {
-        mClips[ i ].x = 0;
-        mClips[ i ].y = i * height;
-        mClips[ i ].w = width;
-        mClips[ i ].h = height;
-    }
-}
-
-
-
 /*
 --------------------------------------------------------------------------------
                                  INIT COLLIDERS
@@ -328,90 +332,26 @@ SDL_Rect& Ship::get_collider_rect( void )
 
 /*
 --------------------------------------------------------------------------------
-                              INIT PIXEL COLLIDERS
---------------------------------------------------------------------------------
- *  Here we initialize the ship's collider rects vector to match those of its
- *  texture object
-*/
-void Ship::init_pixel_colliders( void )
-{
-    for( int i = 0; i < 30; ++i )
-    {
-        mColliders[ i ] = mTextureObject->get_pixel_collider( i );
-    }
-}
-
-
-
-/*
---------------------------------------------------------------------------------
-                              TRANSLATE COLLIDERS
+                              GET PIXEL COLLIDERS
 --------------------------------------------------------------------------------
- *  This function scales the colliders to match the ship's own scale; the number
- *  of colliders is scaled, as are the dimensions and positions of each collider
- *  retained
+ *  The frame's colliders, relative to the ship's position (no copying)
 */
-void Ship::translate_colliders( int scale )
+std::vector<Collider>& Ship::get_pixel_collider( int frame )
 {
-    /*
-     *  Here we create a new, temporary collider rects vector to store the data
-     *  from the texture object's own corresponding colliders.  We do this for
-     *  as many frames as are relevant to the particular instance calling this
-     *  method.
-     */
-    std::vector<Collider> tColliders[ mMaxFrames ];
-    for( int i = 0; i < mMaxFrames; ++i )
-    {
-        tColliders[ i ] = mTextureObject->get_pixel_collider( i );
-    }
-
-    /*
-     *  Go through the ship object's vector of colliders, scaling the
-     *  corresponding temporary (local) texture colliders to match the ship's
-     *  scale, including relative collider rect location, the positions and the
-     *  dimensions.
-     */
-    for( int f = 0; f < mMaxFrames; ++f )
-    {
-        mColliders[ f ].clear();
-
-        for( unsigned int c = 0; c < tColliders[ f ].size(); c += scale )
-        {
-            Collider collider;
-            collider.x = (tColliders[ f ][ c ].x / scale);
-            collider.y = c/scale;
-            collider.w = tColliders[ f ][ c ].w / scale;
-            collider.h = 1;
-
-            mColliders[ f ].push_back( collider );
-        }
-    }
+    return( mSheet->get_colliders( frame ) );
 }
 
 
 
 /*
 --------------------------------------------------------------------------------
-                              GET PIXEL COLLIDERS
+                                 GET PIXEL MASK
 --------------------------------------------------------------------------------
- *  Return a fresh copy of the colliders vector
+ *  The frame's mask, relative to the ship's position (no copying)
 */
-std::vector<Collider> Ship::get_pixel_collider( int frame )
+PixelMask& Ship::get_pixel_mask( int frame )
 {
-    std::vector<Collider> colliders;
-
-    for( int i = 0; i < mHeight; ++i )
-    {
-        Collider collider;
-        collider.x = mColliders[ frame ][ i ].x + mPos.x;
-        collider.y = mColliders[ frame ][ i ].y + mPos.y;
-        collider.w = mColliders[ frame ][ i ].w;
-        collider.h = 1;
-
-        colliders.push_back( collider );
-    }
-
-    return( colliders );
+    return( mSheet->get_mask( frame ) );
 }
 
 
@@ -423,62 +363,8 @@ std::vector<Collider> Ship::get_pixel_collider( int frame )
 */
 void Ship::init_explosion( void )
 {
-    /*  choices[ rand() % 2 ] will yield either a negative or a positive one */
-    int choices[] = { -1, 1 };
-
-    /*  The number of particles to draw -- min 20, max 99 */
-    mParticlesToDraw = ( rand() % 80 ) + 20;
-
-    /*  For each type of debris */
-    for( int c = 0; c < TOTAL_DEBRIS; ++c )
-    {
-        for( int p = 0; p < mParticlesToDraw; ++p )
-        {
-            /*  Starting positions */
-            mDebris[ c ][ p ].pos.x = ( mPos.x + ( mWidth / 2 ) +
-                ((( rand() % 10 ) + 1 ) * choices[ rand() % 2 ] ));
-            mDebris[ c ][ p ].pos.y = ( mPos.y + ( mHeight / 2 ) +
-                ((( rand() % 10 ) + 1 ) * choices[ rand() % 2 ] ));
-
-            /*  Ending positions */
-            mDebris[ c ][ p ].end.x = ( mPos.x +
-                ((( rand() % 400 ) + 1 ) * choices[ rand() % 2 ] ));
-            mDebris[ c ][ p ].end.y = ( mPos.y +
-                ((( rand() % 400 ) + 1 ) * choices[ rand() % 2 ] ));
-
-            /*  Random velocity */
-            mDebris[ c ][ p ].velocity.x = ( rand() % 5 ) + 1;
-            mDebris[ c ][ p ].velocity.y = ( rand() % 5 ) + 1;
-
-            /*  Direction */
-            mDebris[ c ][ p ].direction.x = choices[ rand() % 2 ];
-            mDebris[ c ][ p ].direction.y = choices[ rand() % 2 ];
-
-            /*  Whether or not this particle 'twinkles' */
-            bool val = false;
-            choices[ rand() % 2 ] == 1 ? val = true : val = false;
-            mDebris[ c ][ p ].twinkle = val;
-
-            /*  Color is set according to current index in the upper for loop */
-            switch( c )
-            {
-                case DEBRIS_WHITE:
-                    mDebris[ c ][ p ].color = colors[ COLOR_WHITE ];
-                    break;
-                case DEBRIS_YELLOW:
-                    mDebris[ c ][ p ].color = colors[ COLOR_YELLOW ];
-                    break;
-                case DEBRIS_ORANGE:
-                    mDebris[ c ][ p ].color = colors[ COLOR_ORANGE ];
-                    break;
-                default:
-                    mDebris[ c ][ p ].color = colors[ rand() % TOTAL_COLORS ];
-                    break;
-            }
-        }
-
-
-    }
+    /*  Blow the ship up into debris */
+    mDebris = debris.add( mPos.x, mPos.y, mWidth, mHeight );
 
     /*  Set 'exploding' to true, because the player is exploding */
     mExploding = true;
@@ -508,91 +394,18 @@ bool Ship::is_player( void )
 
 /*
 --------------------------------------------------------------------------------
-                                RENDER EXPLODING
+                                UPDATE EXPLODING
 --------------------------------------------------------------------------------
- *  Technically, this both renders and updates the explosion debris particles.
- *  I know, I know, I am a naughty little boy.
+ *  The debris pool moves the particles along (see update_main()); all we do
+ *  here is notice when they've all faded out.
 */
-void Ship::render_exploding( void )
+void Ship::update_exploding( void )
 {
-    /*  Counters to determine if we're done rendering explosion particles */
-    int done[ 4 ];
-    for( int d = 0; d < 4; ++d )
-        done[ d ] = 0;              //  Init to 0
-
-    /*  For each particle that we're going to draw */
-    for( int c = 0; c < TOTAL_DEBRIS; ++c )
-    {
-        for( int p = 0; p < mParticlesToDraw; ++p )
-        {
-            /*  Move the debris along the X axis */
-            mDebris[ c ][ p ].pos.x += (
-                    mDebris[ c ][ p ].velocity.x *
-                    mDebris[ c ][ p ].direction.x );
-
-            /*  Move the debris along the Y axis */
-            mDebris[ c ][ p ].pos.y += (
-                    mDebris[ c ][ p ].velocity.y *
-                    mDebris[ c ][ p ].direction.y );
-
-            /*
-             *  We're using a separate integer for the alpha value because
-             *  the Uint8s behave strangely when decreased to below zero; this
-             *  is easier to work with.
-             */
-            int alpha = mDebris[ c ][ p ].color.a;      //  Set to alpha value
-            alpha -= ( rand() % 3 ) + 4;                //  Decrease alpha
-
-            /*  If the alpha falls to zero or less, set it to zero */
-            if( alpha <= 0 )
-            {
-                ++done[ c ];    //  We're done with this array of particles
-                alpha = 0;
-            }
-
-            /*  Twinkle */
-            if( mDebris[ c ][ p ].twinkle )
-            {
-                /*  1 in 64 chance of twinkling */
-                if( (rand() % 64) == 0 )
-                {
-                    if( alpha > 0 && alpha < 127 )
-                        alpha += 127;
-                }
-            }
-
-            /*  Set color alpha value */
-            mDebris[ c ][ p ].color.a = alpha;
-
-            /*  Set render draw color */
-            SDL_SetRenderDrawColor( gRenderer,
-                    mDebris[ c ][ p ].color.r,
-                    mDebris[ c ][ p ].color.g,
-                    mDebris[ c ][ p ].color.b,
-                    mDebris[ c ][ p ].color.a );
-
-            /*  Draw point */
-            SDL_RenderDrawPoint( gRenderer,
-                    mDebris[ c ][ p ].pos.x,
-                    mDebris[ c ][ p ].pos.y );
-        }
-    }
-
-
-    /*  Check to see if we're all done */
-    bool allDone = true;
-    for( int d = 0; d < 4; ++d )
-    {
-        if( done[ d ] < mParticlesToDraw )
-        {
-            allDone = false;
-            break;
-        }
-    }
-
     /*  If we're done, end the explosion and continue play */
-    if( allDone )
+    if( debris.is_done( mDebris ) )
     {
+        debris.free_cloud( mDebris );
+        mDebris = -1;
         mExploding = false;
 
         if( mPlayer && mLives > 0 )
@@ -604,6 +417,7 @@ void Ship::render_exploding( void )
 }
 
 
+
 /*
 --------------------------------------------------------------------------------
                                   IS EXPLODING
@@ -643,13 +457,14 @@ void Ship::draw_colliders( std::vector<Collider> colliders )
 void Ship::draw_default_colliders( void )
 {
     SDL_SetRenderDrawColor( gRenderer, 0, 255, 0, 127 );
-    for( unsigned int c = 0; c < mColliders[ mFrame ].size(); ++c )
+    std::vector<Collider> &shape = mSheet->get_colliders( mFrame );
+    for( unsigned int c = 0; c < shape.size(); ++c )
     {
         SDL_Rect r;
-        r.x = mPos.x + mColliders[ mFrame ][ c ].x;
-        r.y = mPos.y + mColliders[ mFrame ][ c ].y;
-        r.w = mColliders[ mFrame ][ c ].w;
-        r.h = mColliders[ mFrame ][ c ].h;
+        r.x = mPos.x + shape[ c ].x;
+        r.y = mPos.y + shape[ c ].y;
+        r.w = shape[ c ].w;
+        r.h = shape[ c ].h;
 
         if( r.w > 0 )
             SDL_RenderFillRect( gRenderer, &r );
@@ -2,37 +2,15 @@
  *  ship.h
  *
  *  This is the header file for the ship class defined in ship.cpp.  The ship
- *  class is inherited by the player class defined in player.cpp, as well as the
- *  enemy class defined in enemy.cpp.
+ *  class is inherited by the player class defined in player.cpp.
  *
 *******************************************************************************/
 #ifndef CLASS_SHIP_H
 #define CLASS_SHIP_H
 
 
-/*  Particle struct, used for all things debris particle */
-struct Particle
-{
-    SDL_Point pos;
-    SDL_Point end;
-    SDL_Color color;
-    SDL_Point direction;
-    SDL_Point velocity;
-    bool twinkle;
-};
-
-enum debrisEnum
-{
-    DEBRIS_WHITE,
-    DEBRIS_COLOR,
-    DEBRIS_YELLOW,
-    DEBRIS_ORANGE,
-    TOTAL_DEBRIS
-};
-
-
 /*
- *  The ship class, which is inherited by the Player and Enemy classes
+ *  The ship class, which is inherited by the Player class
  */
 class Ship
 {
@@ -46,6 +24,9 @@ class Ship
         /*  Set texture object */
         void set_texture_object( Texture *texture );
 
+        /*  Set the sprite sheet (clips and colliders) */
+        void set_sprite_sheet( SpriteSheet *sheet );
+
         /*  Set / get dimensions */
         void set_width( int width );
         void set_height( int height );
@@ -59,19 +40,22 @@ class Ship
         int get_pos_x( void );
         int get_pos_y( void );
 
+        /*  Position blended between the last two ticks, for rendering */
+        int get_render_x( void );
+        int get_render_y( void );
+
         /*  Render */
         void render( void ); /*  Collider stuff */
 
         /*  Collider stuff */
         void init_colliders( void );
-        void init_pixel_colliders( void );
         void init_collider_circ( int radius );
         void init_collider_rect( int width, int height );
         void adjust_colliders( void );
         Circle& get_collider_circ( void );
         SDL_Rect& get_collider_rect( void );
-        void translate_colliders( int scale );
-        std::vector<Collider> get_pixel_collider( int frame = 0 );
+        std::vector<Collider>& get_pixel_collider( int frame = 0 );
+        PixelMask& get_pixel_mask( int frame = 0 );
 
         /*  Get rect for current object */
         SDL_Rect get_rect( void );
@@ -83,14 +67,10 @@ class Ship
         int get_max_frames( void );
         int get_current_frame( void );
 
-        /*  Set clips */
-        void init_clips( int rows, int columns, int width, int height );
-        void init_clips_vertical( int width, int height, int frames );
-
         /*  Explosion stuff */
         void init_explosion( void );
         bool is_exploding( void );
-        void render_exploding( void );
+        void update_exploding( void );
 
         /*  Set / get player status */
         void set_player( bool isPlayer );
@@ -112,24 +92,24 @@ class Ship
         /*  A pointer to the texture object this ship will render */
         Texture *mTextureObject;
 
-        /*  Colliders vector */
+        /*  Clips and pixel colliders, shared with the texture */
+        SpriteSheet *mSheet;
+
+        /*  Colliders */
         Circle mColliderCircle;
         SDL_Rect mColliderRect;
-        std::vector<Collider> mColliders[ 30 ];
 
         /*  Dimensions */
         int mWidth, mHeight;
 
-        /*  Position */
+        /*  Position, and where we were as of the previous tick */
         SDL_Point mPos;
+        SDL_Point mPrevPos;
 
         /*  Frames in animation, max clipping frames */
         int mMaxFrames;
         int mFrame;
 
-        /*  Texture clips */
-        SDL_Rect mClips[ 30 ];
-
         /*  Is the ship alive? */
         bool mAlive;
         int mLives;
@@ -140,11 +120,8 @@ class Ship
         /*  Is it exploding? */
         bool mExploding;
 
-        /*  Debris particles */
-        Particle mDebris[ TOTAL_DEBRIS ][100];
-
-        /*  The number of particles we want to draw */
-        int mParticlesToDraw;
+        /*  What's left of the ship when it explodes (in debris), or -1 */
+        int mDebris;
 
         /*  Is this ship controlled by the player? */
         bool mPlayer;
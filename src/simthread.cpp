@@ -0,0 +1,244 @@
+/*******************************************************************************
+ *  simthread.cpp
+ *
+ *  This file defines threaded mode (--threaded), where the simulation runs on
+ *  a thread of its own at a fixed 1/FPS seconds per tick and the main thread
+ *  does nothing but handle events and draw.  A slow frame or a long wait on
+ *  vsync no longer holds up the simulation, and on a machine with more than
+ *  one core the drawing and the ticking overlap.
+ *
+ *  After every tick the simulation copies the world into a snapshot and hands
+ *  it over through a triple buffer, so live play gets drawn without touching
+ *  the live game objects at all.  Everything else shares the world lock:  the
+ *  simulation holds it for each tick, and the main thread holds it while it
+ *  handles events and while it draws any screen other than live play.
+ *
+ *  Anything that makes textures has to happen on the main thread, which is
+ *  why the game over is put off until the main thread gets to it.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*  Guards the game world */
+static SDL_mutex *worldLock = NULL;
+
+/*  Tells the simulation thread to keep going */
+static SDL_atomic_t simRunning;
+
+/*  Snapshots on their way from the simulation to the renderer */
+static SnapshotBuffer snapshots;
+
+/*  The main thread, which is the only one allowed to touch textures */
+static SDL_threadID mainThread = 0;
+
+/*  Set when the game ended on the simulation thread (guarded by worldLock) */
+static bool gameOverPending = false;
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                   SIM THREAD
+--------------------------------------------------------------------------------
+ *  Run a tick every 1/FPS seconds until told to stop.  If we ever fall more
+ *  than MAX_TICKS_PER_FRAME ticks behind, the missed time is just dropped,
+ *  same as the single-threaded loop does.
+*/
+static int sim_thread( void *data )
+{
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+    Uint64 tickLength = frequency / FPS;
+    Uint64 nextTick = SDL_GetPerformanceCounter();
+
+    while( SDL_AtomicGet( &simRunning ) )
+    {
+        Uint64 now = SDL_GetPerformanceCounter();
+
+        /*  Not time yet; sleep through most of the wait */
+        if( now < nextTick )
+        {
+            Uint32 ms = (Uint32)( ( nextTick - now ) * 1000 / frequency );
+            SDL_Delay( ms > 1 ? ms - 1 : 0 );
+            continue;
+        }
+
+        SDL_LockMutex( worldLock );
+
+        update();
+
+        /*
+         *  Only live play (and the transitions in and out of it) gets drawn
+         *  from snapshots
+         */
+        if( currentScreen == SCREEN_MAIN || currentScreen == SCREEN_TRANSITION )
+        {
+            snapshots.get_back()->capture();
+            snapshots.publish();
+        }
+
+        SDL_UnlockMutex( worldLock );
+
+        nextTick += tickLength;
+        if( now > nextTick + tickLength * MAX_TICKS_PER_FRAME )
+            nextTick = now;
+    }
+
+    return( 0 );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                 RUN THREADED
+--------------------------------------------------------------------------------
+ *  Start the simulation thread and run the main thread's loop until the player
+ *  quits.  Returns false if the thread couldn't be started, in which case the
+ *  caller should carry on single-threaded.
+*/
+bool run_threaded( FramePacer &pacer )
+{
+    mainThread = SDL_ThreadID();
+
+    worldLock = SDL_CreateMutex();
+    if( worldLock == NULL )
+    {
+        printf("WARNING:  Could not create world lock.  SDL Error:  %s\n",
+                SDL_GetError() );
+        return( false );
+    }
+
+    SDL_AtomicSet( &simRunning, 1 );
+    SDL_Thread *simThread = SDL_CreateThread( sim_thread, "simulation", NULL );
+    if( simThread == NULL )
+    {
+        printf("WARNING:  Could not start simulation thread.  SDL Error:  %s\n",
+                SDL_GetError() );
+        SDL_DestroyMutex( worldLock );
+        worldLock = NULL;
+        return( false );
+    }
+
+    /*  Create event queue struct */
+    SDL_Event e;
+
+    while( quit == false )
+    {
+        Uint64 frameStart = SDL_GetPerformanceCounter();
+
+        PROFILE_BEGIN_FRAME();
+
+        SDL_LockMutex( worldLock );
+
+        /*  Handle all events */
+        {
+            PROFILE_SCOPE( PROF_EVENTS );
+            handle_events( e );
+        }
+
+        /*  If the game ended on the simulation thread, finish it off here */
+        if( gameOverPending )
+        {
+            gameOverPending = false;
+            game_over();
+        }
+
+        SDL_UnlockMutex( worldLock );
+
+        /*  Draw the window background */
+        SDL_SetRenderDrawColor( gRenderer, 0, 0, 0, 255 );
+        SDL_RenderClear( gRenderer );
+
+        /*
+         *  Render everything else.  Only this thread ever changes the current
+         *  screen, so it's safe to look at without the lock.
+         */
+        {
+            PROFILE_SCOPE( PROF_RENDER );
+
+            if( currentScreen == SCREEN_MAIN )
+                render_main();
+            else
+            {
+                SDL_LockMutex( worldLock );
+                render();
+                SDL_UnlockMutex( worldLock );
+            }
+
+            PROFILE_RENDER();
+        }
+
+        /*  Show what's been rendered */
+        {
+            PROFILE_SCOPE( PROF_PRESENT );
+            SDL_RenderPresent( gRenderer );
+        }
+
+        PROFILE_END_FRAME();
+
+        /*
+         *  Keep track of what drawing live play is costing, if this is a
+         *  stress test.  The snapshot is the one that was just drawn.
+         */
+        if( stress && currentScreen == SCREEN_MAIN )
+        {
+            WorldSnapshot *snapshot = get_latest_snapshot();
+            if( snapshot != NULL )
+            {
+                WorldView view = snapshot->get_view();
+                stress_sample( SDL_GetPerformanceCounter() - frameStart,
+                        view );
+            }
+        }
+
+        /*  Wait for the next frame, if we're not vsyncing */
+        if( limitFPS )
+            pacer.wait();
+    }
+
+    /*  Stop the simulation */
+    SDL_AtomicSet( &simRunning, 0 );
+    SDL_WaitThread( simThread, NULL );
+
+    SDL_DestroyMutex( worldLock );
+    worldLock = NULL;
+
+    return( true );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                DEFER GAME OVER
+--------------------------------------------------------------------------------
+ *  Called by game_over().  If we're on the simulation thread, flag the game
+ *  over for the main thread to deal with and return true; otherwise return
+ *  false and let game_over() carry on.
+*/
+bool defer_game_over( void )
+{
+    if( ! threaded || SDL_ThreadID() == mainThread )
+        return( false );
+
+    gameOverPending = true;
+
+    return( true );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                              GET LATEST SNAPSHOT
+--------------------------------------------------------------------------------
+ *  The newest world snapshot, or NULL if there hasn't been one yet.  Only the
+ *  main thread should call this.
+*/
+WorldSnapshot* get_latest_snapshot( void )
+{
+    return( snapshots.get_latest() );
+}
@@ -0,0 +1,197 @@
+/*******************************************************************************
+ *  snapshot.cpp
+ *
+ *  This file defines the world snapshot, a copy of everything the main screen
+ *  draws, and the triple buffer the simulation thread uses to hand snapshots
+ *  to the renderer.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*
+--------------------------------------------------------------------------------
+                                 GET LIVE VIEW
+--------------------------------------------------------------------------------
+ *  A view of the live game objects themselves
+*/
+WorldView get_live_view( void )
+{
+    WorldView view;
+
+    view.player = &player;
+    view.enemies = &enemies;
+    view.aExplosions = &aExplosions;
+    view.debris = &debris;
+    view.starfield = starfield;
+    view.tail = &tail;
+    view.kissKills = &kissKills;
+    view.score = currentScore;
+    view.osdAlpha = osdAlpha;
+    view.screenFlashes = screenFlashes;
+
+    return( view );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                  CONSTRUCTOR
+--------------------------------------------------------------------------------
+*/
+WorldSnapshot::WorldSnapshot( void )
+{
+    mStarfield = NULL;
+    mScore = 0;
+    mOsdAlpha = 0;
+    mScreenFlashes = 0;
+    mTime = 0;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   DESTRUCTOR
+--------------------------------------------------------------------------------
+*/
+WorldSnapshot::~WorldSnapshot( void )
+{
+    delete mStarfield;
+    mStarfield = NULL;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                    CAPTURE
+--------------------------------------------------------------------------------
+ *  Copy the live world.  The vectors keep their memory from one capture to
+ *  the next, so once things have settled in this is mostly just copying.
+*/
+void WorldSnapshot::capture( void )
+{
+    mPlayer = player;
+    mEnemies = enemies;
+    mAExplosions = aExplosions;
+    mDebris.copy_active( debris );
+    mTail = tail;
+    mKissKills = kissKills;
+
+    /*  The starfield's constructor makes stars, so only copy-construct once */
+    if( mStarfield == NULL )
+        mStarfield = new Starfield( *starfield );
+    else
+        *mStarfield = *starfield;
+
+    mScore = currentScore;
+    mOsdAlpha = osdAlpha;
+    mScreenFlashes = screenFlashes;
+
+    mTime = SDL_GetPerformanceCounter();
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                    GET VIEW
+--------------------------------------------------------------------------------
+*/
+WorldView WorldSnapshot::get_view( void )
+{
+    WorldView view;
+
+    view.player = &mPlayer;
+    view.enemies = &mEnemies;
+    view.aExplosions = &mAExplosions;
+    view.debris = &mDebris;
+    view.starfield = mStarfield;
+    view.tail = &mTail;
+    view.kissKills = &mKissKills;
+    view.score = mScore;
+    view.osdAlpha = mOsdAlpha;
+    view.screenFlashes = mScreenFlashes;
+
+    return( view );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                    GET TIME
+--------------------------------------------------------------------------------
+*/
+Uint64 WorldSnapshot::get_time( void )
+{
+    return( mTime );
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                            SNAPSHOT BUFFER CONSTRUCTOR
+--------------------------------------------------------------------------------
+ *  The simulation starts out with snapshot 0, the middle is 1 and the renderer
+ *  has 2 (which stays empty until the first publish).
+*/
+SnapshotBuffer::SnapshotBuffer( void )
+{
+    mBack = 0;
+    SDL_AtomicSet( &mMiddle, 1 );
+    mFront = 2;
+    mHaveFront = false;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                            SNAPSHOT BUFFER DESTRUCTOR
+--------------------------------------------------------------------------------
+*/
+SnapshotBuffer::~SnapshotBuffer( void )
+{
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                GET BACK / PUBLISH
+--------------------------------------------------------------------------------
+ *  Simulation side.  Publishing swaps the freshly filled back snapshot into
+ *  the middle, and whatever was in the middle (picked up or not) becomes the
+ *  next back snapshot.
+*/
+WorldSnapshot* SnapshotBuffer::get_back( void )
+{
+    return( &mSnapshots[ mBack ] );
+}
+
+void SnapshotBuffer::publish( void )
+{
+    mBack = SDL_AtomicSet( &mMiddle, mBack | SNAPSHOT_FRESH ) & 3;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   GET LATEST
+--------------------------------------------------------------------------------
+ *  Render side.  If there's a fresh snapshot in the middle, swap our front one
+ *  for it; otherwise keep drawing the one we've got.
+*/
+WorldSnapshot* SnapshotBuffer::get_latest( void )
+{
+    if( SDL_AtomicGet( &mMiddle ) & SNAPSHOT_FRESH )
+    {
+        mFront = SDL_AtomicSet( &mMiddle, mFront ) & 3;
+        mHaveFront = true;
+    }
+
+    if( ! mHaveFront )
+        return( NULL );
+
+    return( &mSnapshots[ mFront ] );
+}
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ *  snapshot.h
+ *
+ *  This is the header file for the world snapshot and snapshot buffer classes,
+ *  defined in snapshot.cpp, which let the simulation and the renderer run on
+ *  different threads (see simthread.cpp).
+ *
+*******************************************************************************/
+#ifndef CLASS_SNAPSHOT_H
+#define CLASS_SNAPSHOT_H
+
+/*  Set on the shared snapshot index until the renderer picks it up */
+#define SNAPSHOT_FRESH 4
+
+/*
+ *  Everything render_main() draws, pointing either at the live game objects or
+ *  at the copies held by a snapshot
+ */
+struct WorldView
+{
+    Player *player;
+    Asteroids *enemies;
+    DenseArray<AtariExplosion> *aExplosions;
+    DebrisPool *debris;
+    Starfield *starfield;
+    Tail *tail;
+    KissKill *kissKills;
+    Uint32 score;               //  Current score
+    Uint8 osdAlpha;             //  OSD opacity
+    Uint32 screenFlashes;       //  Flashes so far (see render_world())
+};
+
+/*
+ *  The WorldSnapshot class
+ */
+class WorldSnapshot
+{
+    public:
+        /*  Constructor */
+        WorldSnapshot( void );
+
+        /*  Destructor */
+        ~WorldSnapshot( void );
+
+        /*  Copy the live game world into this snapshot */
+        void capture( void );
+
+        /*  Get a view of the copies for render_main() */
+        WorldView get_view( void );
+
+        /*  Performance counter value when this was captured */
+        Uint64 get_time( void );
+
+    private:
+        /*  Copies of the game objects */
+        Player mPlayer;
+        Asteroids mEnemies;
+        DenseArray<AtariExplosion> mAExplosions;
+        DebrisPool mDebris;                 //  Only the clouds still going
+        Starfield *mStarfield;
+        Tail mTail;
+        KissKill mKissKills;
+
+        /*  Copies of the odds and ends */
+        Uint32 mScore;
+        Uint8 mOsdAlpha;
+        Uint32 mScreenFlashes;
+
+        /*  When this was captured */
+        Uint64 mTime;
+
+        /*  Snapshots are big; they get reused, never copied */
+        WorldSnapshot( const WorldSnapshot &other );
+        WorldSnapshot& operator=( const WorldSnapshot &other );
+};
+
+/*
+ *  The SnapshotBuffer class
+ *
+ *  A triple buffer:  the simulation fills in the back snapshot and swaps it
+ *  with the middle one, and the renderer swaps the middle one with its front
+ *  snapshot whenever there's a fresh one.  Neither side ever waits on the
+ *  other.
+ */
+class SnapshotBuffer
+{
+    public:
+        /*  Constructor */
+        SnapshotBuffer( void );
+
+        /*  Destructor */
+        ~SnapshotBuffer( void );
+
+        /*  Simulation side:  the snapshot to fill in, then hand it over */
+        WorldSnapshot* get_back( void );
+        void publish( void );
+
+        /*  Render side:  the newest snapshot, or NULL if there isn't one yet */
+        WorldSnapshot* get_latest( void );
+
+    private:
+        /*  The three snapshots */
+        WorldSnapshot mSnapshots[ 3 ];
+
+        /*  Index of the middle snapshot, plus SNAPSHOT_FRESH if it's new */
+        SDL_atomic_t mMiddle;
+
+        /*  Indices owned by the simulation and the renderer, respectively */
+        int mBack;
+        int mFront;
+
+        /*  Has the renderer gotten a snapshot yet? */
+        bool mHaveFront;
+};
+
+#endif
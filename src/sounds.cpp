@@ -1,8 +1,8 @@
 /*******************************************************************************
  *  sounds.cpp
  *
- *  This file defines the functions that control the toggling and muting of
- *  all sound effects and music.
+ *  This file defines the functions that control the playing, toggling and
+ *  muting of all sound effects and music.
  *
 *******************************************************************************/
 #ifndef UTIL_H
@@ -10,6 +10,25 @@
 #endif
 
 
+/*
+--------------------------------------------------------------------------------
+                                   PLAY SOUND
+--------------------------------------------------------------------------------
+ *  Plays a sound effect on the given channel (-1 for the first free one) and
+ *  returns the channel it ended up on.  Everything in the game goes through
+ *  here rather than calling SDL_mixer directly so that the headless mode,
+ *  which never opens an audio device, can simply skip it.
+*/
+int play_sound( Mix_Chunk *chunk, int channel )
+{
+    if( headless )
+        return( -1 );
+
+    return( Mix_PlayChannel( channel, chunk, 0 ) );
+}
+
+
+
 /*
 --------------------------------------------------------------------------------
                                   TOGGLE MUSIC
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ *  spritebatch.cpp
+ *
+ *  This file defines the SpriteBatch class, which draws lots of sprites from
+ *  the same texture (or solid colored quads) in one go.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*
+--------------------------------------------------------------------------------
+                                  CONSTRUCTOR
+--------------------------------------------------------------------------------
+*/
+SpriteBatch::SpriteBatch( void )
+{
+    mTexture = NULL;
+    mBlendMode = SDL_BLENDMODE_NONE;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      ADD
+--------------------------------------------------------------------------------
+ *  Work out the quad's corners and texture coordinates and tack it on to the
+ *  batch, drawing the batch first if it's for a different texture or blend
+ *  mode.  A quad with no texture is drawn in its color, and blends the way
+ *  points and lines do.
+*/
+void SpriteBatch::add( Texture *texture, int x, int y, int width, int height,
+        SDL_Rect *clip, SDL_Color *color )
+{
+    SDL_Texture *sdlTexture = NULL;
+    SDL_BlendMode blendMode;
+
+    if( texture != NULL )
+    {
+        sdlTexture = texture->get_sdl_texture();
+        if( sdlTexture == NULL )
+            return;
+
+        SDL_GetTextureBlendMode( sdlTexture, &blendMode );
+    }
+    else
+    {
+        /*  Without a texture, the color is all there is */
+        if( color == NULL )
+            return;
+
+        SDL_GetRenderDrawBlendMode( gRenderer, &blendMode );
+    }
+
+    if( sdlTexture != mTexture || blendMode != mBlendMode )
+    {
+        flush();
+        mTexture = sdlTexture;
+        mBlendMode = blendMode;
+    }
+
+    /*  The color the quad gets multiplied by */
+    SDL_Color tint;
+    if( color != NULL )
+        tint = *color;
+    else
+    {
+        texture->get_color_mod( &tint.r, &tint.g, &tint.b );
+        tint.a = texture->get_alpha();
+    }
+
+    /*  Which part of the texture it shows */
+    float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+    if( texture == NULL )
+        u1 = v1 = 0.0f;
+    else if( clip != NULL )
+    {
+        float texW = (float)texture->get_texture_width();
+        float texH = (float)texture->get_texture_height();
+
+        u0 = clip->x / texW;
+        v0 = clip->y / texH;
+        u1 = ( clip->x + clip->w ) / texW;
+        v1 = ( clip->y + clip->h ) / texH;
+    }
+
+    int first = (int)mVertices.size();
+
+    SDL_Vertex corner;
+    corner.color = tint;
+
+    corner.position.x = (float)x;
+    corner.position.y = (float)y;
+    corner.tex_coord.x = u0;
+    corner.tex_coord.y = v0;
+    mVertices.push_back( corner );
+
+    corner.position.x = (float)( x + width );
+    corner.tex_coord.x = u1;
+    mVertices.push_back( corner );
+
+    corner.position.y = (float)( y + height );
+    corner.tex_coord.y = v1;
+    mVertices.push_back( corner );
+
+    corner.position.x = (float)x;
+    corner.tex_coord.x = u0;
+    mVertices.push_back( corner );
+
+    /*  Two triangles per quad */
+    mIndices.push_back( first );
+    mIndices.push_back( first + 1 );
+    mIndices.push_back( first + 2 );
+    mIndices.push_back( first );
+    mIndices.push_back( first + 2 );
+    mIndices.push_back( first + 3 );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                     FLUSH
+--------------------------------------------------------------------------------
+*/
+void SpriteBatch::flush( void )
+{
+    if( ! mIndices.empty() )
+    {
+        SDL_RenderGeometry( gRenderer, mTexture, &mVertices[ 0 ],
+                (int)mVertices.size(), &mIndices[ 0 ], (int)mIndices.size() );
+    }
+
+    mVertices.clear();
+    mIndices.clear();
+    mTexture = NULL;
+}
@@ -0,0 +1,54 @@
+/*******************************************************************************
+ *  spritebatch.h
+ *
+ *  This is the header file for the SpriteBatch class, defined in
+ *  spritebatch.cpp.
+ *
+*******************************************************************************/
+#ifndef CLASS_SPRITE_BATCH_H
+#define CLASS_SPRITE_BATCH_H
+
+/*
+ *  The SpriteBatch class
+ *
+ *  Collects quads and draws them with one SDL_RenderGeometry() call instead
+ *  of an SDL_RenderCopy() (or SDL_RenderFillRect()) each.  Quads pile up for
+ *  as long as they use the same texture (or none) and blend mode; a quad that
+ *  uses something else draws the pile first, so things still come out in the
+ *  order they were added.  Whoever adds quads has to flush() when they're
+ *  done, before anything else gets drawn.
+ *
+ *  SDL_RenderGeometry() doesn't use the texture's color and alpha mods, so
+ *  they go on each quad's vertices instead.
+ *
+ *  Only use this from the thread that renders.
+ */
+class SpriteBatch
+{
+    public:
+        /*  Constructor */
+        SpriteBatch( void );
+
+        /*
+         *  Add a quad showing the clip (or all) of the texture at the given
+         *  rect.  With no color given, it uses the texture's color and alpha
+         *  mods, like Texture::render() would.  With no texture, the quad is
+         *  just filled with the color (which then has to be given).
+         */
+        void add( Texture *texture, int x, int y, int width, int height,
+                SDL_Rect *clip = NULL, SDL_Color *color = NULL );
+
+        /*  Draw whatever's been added */
+        void flush( void );
+
+    private:
+        /*  What the quads in the batch are drawn with */
+        SDL_Texture *mTexture;
+        SDL_BlendMode mBlendMode;
+
+        /*  The quads, kept to save reallocating */
+        std::vector<SDL_Vertex> mVertices;
+        std::vector<int> mIndices;
+};
+
+#endif
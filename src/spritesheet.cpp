@@ -0,0 +1,283 @@
+/*******************************************************************************
+ *  spritesheet.cpp
+ *
+ *  This file defines the SpriteSheet class, which holds the clips and the
+ *  per-pixel colliders and masks of a sprite sheet so that they only ever get
+ *  worked out once.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*
+--------------------------------------------------------------------------------
+                                  CONSTRUCTOR
+--------------------------------------------------------------------------------
+*/
+SpriteSheet::SpriteSheet( void )
+{
+    mSize = mFrames = 0;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                   DESTRUCTOR
+--------------------------------------------------------------------------------
+*/
+SpriteSheet::~SpriteSheet( void )
+{
+    mClips.clear();
+    mColliders.clear();
+    mMasks.clear();
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                      INIT
+--------------------------------------------------------------------------------
+ *  Set up the clips for a one-column sheet of square frames, and generate the
+ *  colliders and masks for each of them from the surface's pixels
+*/
+void SpriteSheet::init( SDL_Surface *surface, int size, int frames )
+{
+    mSize = size;
+    mFrames = frames;
+
+    mClips.resize( frames );
+    mColliders.resize( frames );
+    mMasks.resize( frames );
+
+    for( int f = 0; f < frames; ++f )
+    {
+        mClips[ f ].x = 0;
+        mClips[ f ].y = f * size;
+        mClips[ f ].w = size;
+        mClips[ f ].h = size;
+
+        generate_colliders( surface, f );
+        generate_mask( surface, f );
+    }
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                  INIT SCALED
+--------------------------------------------------------------------------------
+ *  The colliders are the source sheet's, with each row taken from the matching
+ *  row of the source and its span shrunk to fit.  Each pixel of a mask covers
+ *  the block of the source's pixels that shrink down onto it, and is set if
+ *  any of them are, so nothing thinner than a block drops out.  The clips are
+ *  left as they are, since the frames are still drawn from the full-size
+ *  texture.
+ *
+ *  This all happens once, at load time, for every size an asteroid can be;
+ *  spawning one doesn't do any of it.
+*/
+void SpriteSheet::init_scaled( SpriteSheet *source, int size )
+{
+    int from = source->mSize;
+
+    mSize = size;
+    mFrames = source->mFrames;
+
+    mClips = source->mClips;
+    mColliders.resize( mFrames );
+    mMasks.resize( mFrames );
+
+    for( int f = 0; f < mFrames; ++f )
+    {
+        std::vector<Collider> &spans = source->mColliders[ f ];
+        std::vector<Collider> &colliders = mColliders[ f ];
+
+        colliders.clear();
+        for( int row = 0; row < mSize; ++row )
+        {
+            Collider &span = spans[ row * from / mSize ];
+
+            Collider collider;
+            collider.x = span.x * mSize / from;
+            collider.y = row;
+            collider.w = span.w * mSize / from;
+            collider.h = 1;
+            collider.a = false;
+
+            colliders.push_back( collider );
+        }
+
+        PixelMask &fromMask = source->mMasks[ f ];
+        PixelMask &mask = mMasks[ f ];
+
+        clear_mask( mask );
+        for( int y = 0; y < fromMask.h; ++y )
+        {
+            int row = y * mSize / from;
+
+            for( int x = 0; x < fromMask.w; ++x )
+            {
+                int col = x * mSize / from;
+
+                Uint64 bit = ( fromMask.bits[ ( y * fromMask.words ) +
+                        ( x / 64 ) ] >> ( x % 64 ) ) & 1;
+
+                mask.bits[ ( row * mask.words ) + ( col / 64 ) ] |=
+                    bit << ( col % 64 );
+            }
+        }
+    }
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                  FRAME INFO
+--------------------------------------------------------------------------------
+*/
+int SpriteSheet::get_frames( void )
+{
+    return( mFrames );
+}
+
+int SpriteSheet::get_size( void )
+{
+    return( mSize );
+}
+
+SDL_Rect* SpriteSheet::get_clip( int frame )
+{
+    return( &mClips[ frame ] );
+}
+
+std::vector<Collider>& SpriteSheet::get_colliders( int frame )
+{
+    return( mColliders[ frame ] );
+}
+
+PixelMask& SpriteSheet::get_mask( int frame )
+{
+    return( mMasks[ frame ] );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                               GENERATE COLLIDERS
+--------------------------------------------------------------------------------
+ *  This method will generate 'colliders' for the given frame of the surface.
+ *  A collider, at least as used in this game, is a rectangle 1 pixel high with
+ *  variable width.  The X position is also variable, and the Y position will
+ *  match the 'row' of the given clip's colliders vector.
+*/
+void SpriteSheet::generate_colliders( SDL_Surface *surface, int frame )
+{
+    /*  Grab a pointer to the surface pixels */
+    Uint32 *pixels = (Uint32*)surface->pixels;
+
+    /*  These will hold the RGBA values */
+    Uint8 r, g, b, a;
+
+    /*  Variable collider rect boundaries */
+    int left, right;
+    int width;
+
+    /*  Clear any colliders that might be in this frame's colliders vector */
+    mColliders[ frame ].clear();
+
+    /*  For each row of this part of the texture (clip) */
+    for( int cRow = 0; cRow < mSize; ++cRow )
+    {
+        /*  Init them both to impossible values */
+        left = right = -1;
+
+        /*  For each column of this texture's clip */
+        for( int cCol = 0; cCol < mSize; ++cCol )
+        {
+            /*  Increment the pixels pointer */
+            ++pixels;
+
+            /*
+             *  Grab the RGBA value for the correct pixel relative to the pixel
+             *  pointer's position.  To be honest, this was 90% brute-force
+             *  guesswork on my part.
+             */
+            SDL_GetRGBA( pixels[ (mSize * frame * mSize) ],
+                    surface->format, &r, &g, &b, &a );
+
+            /*  If the alpha of the pixel isn't zero */
+            if( a != 0 )
+            {
+                /*  If the left value has not been set to something real yet */
+                if( left < 0 )
+                    left = cCol;
+
+                /*  Just keep readjusting the rightmost boundary */
+                right = cCol;
+            }
+        }
+
+        /*  Get the width by, what else, subtracted left from right */
+        width = right - left;
+
+        /*  If there were no visible pixels, set the width to zero */
+        if( left < 0 )
+            width = 0;
+
+        /*  Create a new collider instance and fill it with data */
+        Collider collider = { left, cRow, width, 1, false };
+
+        /*  Push it onto this frame's colliders vector */
+        mColliders[ frame ].push_back( collider );
+    }
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                 GENERATE MASK
+--------------------------------------------------------------------------------
+ *  Set a bit in the frame's mask for every pixel with any alpha at all
+*/
+void SpriteSheet::generate_mask( SDL_Surface *surface, int frame )
+{
+    PixelMask &mask = mMasks[ frame ];
+    clear_mask( mask );
+
+    /*  These will hold the RGBA values */
+    Uint8 r, g, b, a;
+
+    for( int y = 0; y < mSize; ++y )
+    {
+        /*  This frame's row, wherever the surface's rows start */
+        Uint32 *pixels = (Uint32*)( (Uint8*)surface->pixels +
+                ( ( ( frame * mSize ) + y ) * surface->pitch ) );
+
+        Uint64 *row = &mask.bits[ y * mask.words ];
+
+        for( int x = 0; x < mSize; ++x )
+        {
+            SDL_GetRGBA( pixels[ x ], surface->format, &r, &g, &b, &a );
+
+            if( a != 0 )
+                row[ x / 64 ] |= (Uint64)1 << ( x % 64 );
+        }
+    }
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                   CLEAR MASK
+--------------------------------------------------------------------------------
+*/
+void SpriteSheet::clear_mask( PixelMask &mask )
+{
+    mask.w = mask.h = mSize;
+    mask.words = ( mSize + 63 ) / 64;
+    mask.bits.assign( mask.h * mask.words, 0 );
+}
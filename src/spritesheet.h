@@ -0,0 +1,71 @@
+/*******************************************************************************
+ *  spritesheet.h
+ *
+ *  This is the header file for the SpriteSheet class, defined in
+ *  spritesheet.cpp.
+ *
+*******************************************************************************/
+#ifndef CLASS_SPRITE_SHEET_H
+#define CLASS_SPRITE_SHEET_H
+
+/*
+ *  The SpriteSheet class
+ *
+ *  The clips, pixel colliders and pixel masks for every frame of a sprite
+ *  sheet, at one particular size.  These are worked out once when the image
+ *  is loaded, and everything drawn from the sheet (the player, every
+ *  asteroid, the texture itself) just points at them.
+ *
+ *  Sheets are one column of square frames.  A scaled-down sheet shares the
+ *  source sheet's clips (it's drawn from the same texture), but has colliders
+ *  and masks of its own.
+ */
+class SpriteSheet
+{
+    public:
+        /*  Constructor */
+        SpriteSheet( void );
+
+        /*  Destructor */
+        ~SpriteSheet( void );
+
+        /*  Cut 'frames' frames of the given size out of the surface */
+        void init( SDL_Surface *surface, int size, int frames );
+
+        /*  Same frames as the source sheet, shrunk down to the given size */
+        void init_scaled( SpriteSheet *source, int size );
+
+        /*  Number of frames, and the size (width and height) of each */
+        int get_frames( void );
+        int get_size( void );
+
+        /*  The part of the texture a frame is drawn from */
+        SDL_Rect* get_clip( int frame );
+
+        /*  A frame's colliders, one per row, relative to the frame */
+        std::vector<Collider>& get_colliders( int frame );
+
+        /*  A frame's pixel mask */
+        PixelMask& get_mask( int frame );
+
+    private:
+        /*  Build a frame's colliders from its pixels */
+        void generate_colliders( SDL_Surface *surface, int frame );
+
+        /*  Build a frame's mask from its pixels */
+        void generate_mask( SDL_Surface *surface, int frame );
+
+        /*  Size up a mask for the sheet's frames, all clear */
+        void clear_mask( PixelMask &mask );
+
+        /*  Size of each frame, and how many there are */
+        int mSize;
+        int mFrames;
+
+        /*  Clips, colliders and masks, one per frame */
+        std::vector<SDL_Rect> mClips;
+        std::vector< std::vector<Collider> > mColliders;
+        std::vector<PixelMask> mMasks;
+};
+
+#endif
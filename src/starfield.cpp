@@ -10,6 +10,27 @@
 #endif
 
 
+/*
+ *  One row's worth of random numbers, filled in a single batch.  Only the
+ *  simulation ever uses it, and it isn't part of the starfield proper (which
+ *  gets copied into every world snapshot), so it lives out here.
+ */
+static std::vector<Uint32> starRolls;
+
+
+/*
+--------------------------------------------------------------------------------
+                                   ROLL ROW
+--------------------------------------------------------------------------------
+ *  Fill starRolls with a random number for each column of the screen
+*/
+static void roll_row( void )
+{
+    starRolls.resize( BWIDTH );
+    rng[ RNG_STARFIELD ].fill( &starRolls[ 0 ], BWIDTH );
+}
+
+
 /*
 --------------------------------------------------------------------------------
                                   CONSTRUCTOR
@@ -18,13 +39,18 @@
 */
 Starfield::Starfield( void )
 {
+    mWarpSpeed = 1;
+    Uint32 odds = Random::odds( 1000 / stressFactor );
+
     /*  Go through every available pixel on the screen */
     for( int row = 0; row < BHEIGHT; ++row )
     {
+        roll_row();
+
         for( int col = 0; col < BWIDTH; ++col )
         {
             /*  Approx. 1 in 1000 chance of there being a star */
-            if( rand() % 1000 == 0 )
+            if( starRolls[ col ] < odds )
                 add_star( col, row );
         }
     }
@@ -54,6 +80,7 @@ void Starfield::add_star( int x, int y )
 {
     /*  Create an instance of the star struct */
     Star star;
+    Random &r = rng[ RNG_STARFIELD ];
 
     /*  Assign position according to given coordinates */
     star.pos.x = x;
@@ -63,21 +90,21 @@ void Starfield::add_star( int x, int y )
      *  There is a 1/4 chance of the star being one of eight of the default
      *  colors available (including white as a possibility)
      */
-    if( rand() % 4 == 0 )
-        star.color = colors[ ( (rand()%8) + 1 ) ];
+    if( r.chance( 4 ) )
+        star.color = colors[ r.range( 8 ) + 1 ];
 
     /*  Otherwise, it's just white */
     else
         star.color = colors[ COLOR_WHITE ];
 
     /*  1/10 chance that the star will twinkle */
-    rand() % 10 == 0 ? star.twinkle = true : star.twinkle = false;
+    star.twinkle = r.chance( 10 );
 
     /*
      *  We set the minimum alpha of all stars from 64 - 191.  This isn't really
      *  used unless the star twinkles, though.
      */
-    star.alphaMin = ( rand() % 127 ) + 64;
+    star.alphaMin = r.range( 127 ) + 64;
 
     /*  Push the star onto the stars vector */
     mStars.push_back( star );
@@ -91,46 +118,50 @@ void Starfield::add_star( int x, int y )
 */
 void Starfield::update( void )
 {
-    /*  Erase dead stars */
-    for( mStar = mStars.begin(); mStar != mStars.end(); )
+    /*  Remember how fast we're going, for render() */
+    mWarpSpeed = warpSpeed;
+
+    /*  Move active stars, and get rid of the ones that have gone by */
+    for( size_t i = 0; i < mStars.size(); ++i )
     {
-        /*  Kill the star */
-        if( mStar->pos.y > BHEIGHT )
-            mStars.erase( mStar );
-        
-        /*  Or don't */
-        else
-            ++mStar;
-    }
+        Star &star = mStars[ i ];
 
+        /*  Kill the star */
+        if( star.pos.y > BHEIGHT )
+        {
+            mStars.remove( i );
+            continue;
+        }
 
-    /*  Move active stars */
-    for( mStar = mStars.begin(); mStar != mStars.end(); ++mStar )
-    {
         /*  Move downward */
-        mStar->pos.y += warpSpeed;
+        star.pos.y += warpSpeed;
 
         /*  Modify star alpha value */
-        if( mStar->twinkle )
+        if( star.twinkle )
         {
             /*  If alpha has gone below minimum threshold, reset it */
-            if( mStar->color.a < mStar->alphaMin )
-                mStar->color.a = 255;
+            if( star.color.a < star.alphaMin )
+                star.color.a = 255;
 
             /*  Otherwise, just decrement star alpha value */
             else
-                --mStar->color.a;
+                --star.color.a;
         }
     }
 
+    mStars.compact();
+
     /*  Create new stars */
+    roll_row();
+    Uint32 odds = Random::odds( 1000 / ( warpSpeed * stressFactor ) );
+
     for( int col = 0; col < BWIDTH; ++col )
     {
         /*
          *  Every 'tick', approx. 1 in 1000 chance of a new star being added to
          *  the top-most row of the pixels on the screen
          */
-        if( rand() % ( 1000 / warpSpeed ) == 0 )
+        if( starRolls[ col ] < odds )
         {
             add_star( col, 0 );
         }
@@ -139,6 +170,17 @@ void Starfield::update( void )
 }
 
 
+/*
+--------------------------------------------------------------------------------
+                                   GET COUNT
+--------------------------------------------------------------------------------
+*/
+int Starfield::get_count( void )
+{
+    return( (int)mStars.size() );
+}
+
+
 /*
 --------------------------------------------------------------------------------
                                      RENDER
@@ -146,39 +188,57 @@ void Starfield::update( void )
  *  The render functions.  The main one just tells the program which actual
  *  rendering function to call.  render_normal() renders the stars during
  *  regular gameplay, whereas render_warp() renders the stars while the player
- *  is 'powered' and moving faster
+ *  is 'powered' and moving faster.
+ *
+ *  All stars move at the same speed, so rather than blending each one between
+ *  ticks we just pull the whole field back by the part of this tick's
+ *  movement that hasn't 'happened' yet.
+ *
+ *  Each star (a point, or a line when warping) is a one pixel wide quad
+ *  carrying its own color, with no texture.  They all go through the sprite
+ *  batch, so however many stars there are, the whole field is a single draw
+ *  call.
 */
 void Starfield::render_normal( void )
 {
-    for( mStar = mStars.begin(); mStar != mStars.end(); ++mStar )
+    int behind = (int)( mWarpSpeed * ( 1.0f - tickInterpolation ) );
+
+    for( size_t i = 0; i < mStars.size(); ++i )
     {
-        /*  Set the render draw color */
-        SDL_SetRenderDrawColor( gRenderer, mStar->color.r, mStar->color.g,
-                mStar->color.b, mStar->color.a );
+        const Star &star = mStars[ i ];
+        SDL_Color color = star.color;
 
-        /*  Draw the point */
-        SDL_RenderDrawPoint( gRenderer, mStar->pos.x, mStar->pos.y );
+        /*  The point */
+        spriteBatch.add( NULL, star.pos.x, star.pos.y - behind, 1, 1, NULL,
+                &color );
     }
+
+    spriteBatch.flush();
 }
 
 void Starfield::render_warp( void )
 {
-    for( mStar = mStars.begin(); mStar != mStars.end(); ++mStar )
+    int behind = (int)( mWarpSpeed * ( 1.0f - tickInterpolation ) );
+    int length = mWarpSpeed * 4;
+
+    for( size_t i = 0; i < mStars.size(); ++i )
     {
-        /*  Set the render draw color */
-        SDL_SetRenderDrawColor( gRenderer, mStar->color.r, mStar->color.g,
-                mStar->color.b, 127 - ( warpSpeed * 3 ) );
-
-        /*  Draw the lines */
-        SDL_RenderDrawLine( gRenderer,
-                mStar->pos.x, mStar->pos.y,
-                mStar->pos.x, mStar->pos.y - ( warpSpeed * 4 ) );
+        const Star &star = mStars[ i ];
+
+        SDL_Color color = star.color;
+        color.a = 127 - ( mWarpSpeed * 3 );
+
+        /*  The line, from the star up to its tail (both ends included) */
+        spriteBatch.add( NULL, star.pos.x, star.pos.y - behind - length, 1,
+                length + 1, NULL, &color );
     }
+
+    spriteBatch.flush();
 }
 
 void Starfield::render( void )
 {
-    if( warpSpeed > 1 )
+    if( mWarpSpeed > 1 )
         render_warp();
     else
         render_normal();
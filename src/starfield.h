@@ -32,6 +32,9 @@ class Starfield
         /*  Update */
         void update( void );
 
+        /*  Number of stars */
+        int get_count( void );
+
         /*  Render */
         void render( void );
         void render_normal( void );
@@ -39,8 +42,10 @@ class Starfield
 
     private:
         /*  The collection of star structs */
-        std::vector<Star> mStars;
-        std::vector<Star>::iterator mStar;      //  Iterator
+        DenseArray<Star> mStars;
+
+        /*  Warp speed as of the last update */
+        int mWarpSpeed;
 };
 
 #endif
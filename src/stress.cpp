@@ -0,0 +1,140 @@
+/*******************************************************************************
+ *  stress.cpp
+ *
+ *  This file defines the stress test report (--stress N).  The test itself is
+ *  just the game with N times the enemies and stars, and the player honking
+ *  and powering up on their own (see update_main()); this keeps track of what
+ *  every tick (headless) or frame (windowed) cost, grouped by how many enemies
+ *  were on screen at the time, and prints it all out at the end.  That shows
+ *  where things stop scaling well, and which part of the tick is to blame.
+ *
+ *  The per-phase columns come from the profiler, so they're only there in
+ *  builds made with 'make profile'.  The profiler only counts the time spent
+ *  on the simulation's own thread; use --jobs 0 to get everything.
+ *
+*******************************************************************************/
+#ifndef UTIL_H
+#include "util.h"
+#endif
+
+
+/*  How many enemies each line of the report covers */
+#define STRESS_BUCKET 250
+
+/*  Running totals for the ticks / frames with a given number of enemies */
+struct StressBucket
+{
+    Uint32 samples;
+    Uint64 counts;
+    Uint64 maxCounts;
+    Uint64 explosions;
+    Uint64 kissKills;
+    Uint64 stars;
+    double phases[ TOTAL_PROFILE_PHASES ];
+};
+
+/*  One bucket for each STRESS_BUCKET enemies, added as they're reached */
+static std::vector<StressBucket> buckets;
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                 STRESS SAMPLE
+--------------------------------------------------------------------------------
+ *  Add one tick or frame (which took 'counts' performance counter units) to
+ *  the bucket for however many enemies are in the given world.  This goes
+ *  after the frame's PROFILE_END_FRAME(), so the profiler has its times.
+*/
+void stress_sample( Uint64 counts, WorldView &view )
+{
+    size_t b = view.enemies->size() / STRESS_BUCKET;
+
+    while( buckets.size() <= b )
+    {
+        StressBucket empty;
+        memset( &empty, 0, sizeof( empty ) );
+        buckets.push_back( empty );
+    }
+
+    StressBucket &bucket = buckets[ b ];
+    ++bucket.samples;
+    bucket.counts += counts;
+    if( counts > bucket.maxCounts )
+        bucket.maxCounts = counts;
+    bucket.explosions += view.aExplosions->size();
+    bucket.kissKills += view.kissKills->get_count();
+    bucket.stars += view.starfield->get_count();
+
+#ifdef PROFILING
+    for( int i = 0; i < TOTAL_PROFILE_PHASES; ++i )
+        bucket.phases[ i ] += profiler.get_last( i );
+#endif
+}
+
+
+
+/*
+--------------------------------------------------------------------------------
+                                 STRESS REPORT
+--------------------------------------------------------------------------------
+ *  One line per bucket:  how many samples there were, the average number of
+ *  everything else, the average and worst cost, and then the average cost of
+ *  each phase that took any time at all.  All times are in milliseconds.
+*/
+void stress_report( void )
+{
+    double countsToMs = 1000.0 / (double)SDL_GetPerformanceFrequency();
+
+    /*  Only show the phases that actually happened */
+    bool showPhase[ TOTAL_PROFILE_PHASES ];
+    for( int i = 0; i < TOTAL_PROFILE_PHASES; ++i )
+    {
+        showPhase[ i ] = false;
+        for( size_t b = 0; b < buckets.size(); ++b )
+        {
+            if( i != PROF_FRAME && buckets[ b ].phases[ i ] > 0.0 )
+                showPhase[ i ] = true;
+        }
+    }
+
+    printf("\nStress test (x%d spawn rate, %s):\n", stressFactor,
+            headless ? "per tick" : "per frame" );
+
+    printf("%-11s %7s %10s %9s %7s %8s %8s", "enemies", "samples",
+            "explosions", "kisskills", "stars", "avg_ms", "max_ms" );
+    for( int i = 0; i < TOTAL_PROFILE_PHASES; ++i )
+    {
+        if( showPhase[ i ] )
+            printf(" %12s", Profiler::get_phase_name( i ) );
+    }
+    printf("\n");
+
+    for( size_t b = 0; b < buckets.size(); ++b )
+    {
+        StressBucket &bucket = buckets[ b ];
+        if( bucket.samples == 0 )
+            continue;
+
+        double n = (double)bucket.samples;
+        char range[ 32 ];
+        snprintf( range, sizeof( range ), "%u-%u",
+                (unsigned)( b * STRESS_BUCKET ),
+                (unsigned)( ( b + 1 ) * STRESS_BUCKET - 1 ) );
+
+        printf("%-11s %7u %10.1f %9.1f %7.1f %8.3f %8.3f", range,
+                bucket.samples, bucket.explosions / n, bucket.kissKills / n,
+                bucket.stars / n, bucket.counts * countsToMs / n,
+                bucket.maxCounts * countsToMs );
+        for( int i = 0; i < TOTAL_PROFILE_PHASES; ++i )
+        {
+            if( showPhase[ i ] )
+                printf(" %12.3f", bucket.phases[ i ] / n );
+        }
+        printf("\n");
+    }
+
+#ifndef PROFILING
+    printf("(Build with 'make profile' for a breakdown by phase)\n");
+#endif
+}
@@ -45,6 +45,9 @@ void Tail::init_tail( void )
 {
     mActive = false;
     mFading = false;
+
+    mWidth = 0;
+    mColor = &colors[ COLOR_WHITE ];
 }
 
 
@@ -54,13 +57,18 @@ void Tail::init_tail( void )
                                      UPDATE
 --------------------------------------------------------------------------------
  *  This method keeps the tail in its correct place -- that is, trailing the
- *  player's position.
+ *  player's position.  It also grabs everything else render() needs from the
+ *  player, so a copy of the tail can be drawn without the player around.
 */
 void Tail::update( void )
 {
     /*  Correct X and Y positions */
     mPos.x = player.get_pos_x();
     mPos.y = player.get_pos_y() + player.get_height() - 8;
+
+    /*  Width and color of the beam */
+    mWidth = player.get_width();
+    mColor = player.get_special_color();
 }
 
 
@@ -76,8 +84,8 @@ void Tail::render( void )
     /*  Length of the tail */
     int y = BHEIGHT;
 
-    /*  Grab a pointer to the player's 'special' color */
-    SDL_Color *playerColor = player.get_special_color();
+    /*  The player's 'special' color, as of the last update */
+    SDL_Color *playerColor = mColor;
 
     /*  Set the colors for the left half */
     Uint8 r = playerColor->r;
@@ -86,7 +94,7 @@ void Tail::render( void )
     Uint8 a = 127;
 
     /*  Left half */
-    for( int x = mPos.x + 24; x < mPos.x + (player.get_width()/2) + 1; ++x )
+    for( int x = mPos.x + 24; x < mPos.x + (mWidth/2) + 1; ++x )
     {
         SDL_SetRenderDrawColor( gRenderer, r, g, b, a );
         SDL_RenderDrawLine( gRenderer, x, mPos.y, x, y );
@@ -105,8 +113,8 @@ void Tail::render( void )
     a = 127;
 
     /*  Right half */
-    for( int x = (mPos.x + player.get_width()) - 20;
-            x > mPos.x + (player.get_width()/2) - 1; --x )
+    for( int x = (mPos.x + mWidth) - 20;
+            x > mPos.x + (mWidth/2) - 1; --x )
     {
         SDL_SetRenderDrawColor( gRenderer, r, g, b, a );
         SDL_RenderDrawLine( gRenderer, x, mPos.y, x, y );
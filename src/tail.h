@@ -47,6 +47,10 @@ class Tail
 
         /*  Position at which to render the tail */
         SDL_Point mPos;
+
+        /*  Player's width and 'special' color, as of the last update */
+        int mWidth;
+        SDL_Color *mColor;
 };
 
 #endif
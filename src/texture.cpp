@@ -19,6 +19,7 @@ Texture::Texture( void )
 {
     /*  Point the texture pointer to nothing at all */
     mTexture = NULL;
+    mSheet = NULL;
 
     /*  Init default (loaded) dimensions */
     mTextureWidth = mTextureHeight = 0;
@@ -61,13 +62,15 @@ Texture::~Texture( void )
 */
 void Texture::free_texture( void )
 {
-    /*  If the texture exists, kill it and null everything out */
+    /*  If the texture exists, kill it */
     if( mTexture != NULL )
     {
         SDL_DestroyTexture( mTexture );
         mTexture = NULL;
-        mTextureWidth = mTextureHeight = mWidth = mHeight = 0;
     }
+
+    /*  Null everything out (headless textures have dimensions but no data) */
+    mTextureWidth = mTextureHeight = mWidth = mHeight = 0;
 }
 
 
@@ -76,11 +79,15 @@ void Texture::free_texture( void )
                             CREATE TEXTURE FROM FILE
 --------------------------------------------------------------------------------
  *  This method creates a texture from an image file (presumably a PNG since
- *  SDL_image was initialized with only that functionality).  It optionally
- *  generates colliders for sprite sheet images.
+ *  SDL_image was initialized with only that functionality).  For sprite sheet
+ *  images, it optionally fills in the given sheet's clips and colliders while
+ *  it has the pixels to hand.
+ *
+ *  If there's no renderer (headless mode), only the dimensions and the sheet
+ *  are kept; nothing is uploaded.
 */
-bool Texture::create_texture_from_file( const char *path, bool clipping,
-        int cWidth, int cHeight, int cCount )
+bool Texture::create_texture_from_file( const char *path, SpriteSheet *sheet,
+        int cSize, int cCount )
 {
     /*  Free the texture if it exists */
     free_texture();
@@ -99,23 +106,23 @@ bool Texture::create_texture_from_file( const char *path, bool clipping,
         gPixelFormat = (Uint32)tempSurface->format->format;
 
     /*  Now, create a texture from the loaded surface */
-    mTexture = SDL_CreateTextureFromSurface( gRenderer, tempSurface );
-    if( mTexture == NULL )
-    {
-        printf("ERROR:  Cannot create texture from surface.  SDL Error:  %s\n",
-                SDL_GetError() );
-        SDL_FreeSurface( tempSurface );
-        return( false );
-    }
-
-    /*  Generate colliders */
-    if( clipping )
+    if( gRenderer != NULL )
     {
-        for( int frame = 0; frame < cCount; ++frame )
+        mTexture = SDL_CreateTextureFromSurface( gRenderer, tempSurface );
+        if( mTexture == NULL )
         {
-            generate_colliders( tempSurface, cWidth, frame );
+            printf("ERROR:  Cannot create texture from surface.  SDL Error:  "
+                    "%s\n", SDL_GetError() );
+            SDL_FreeSurface( tempSurface );
+            return( false );
         }
+    }
 
+    /*  Generate clips and colliders */
+    if( sheet != NULL )
+    {
+        sheet->init( tempSurface, cSize, cCount );
+        mSheet = sheet;
     }
 
     /*  Get dimensions from surface */
@@ -173,6 +180,17 @@ bool Texture::create_texture_from_string( TTF_Font *font, const char *string,
 }
 
 
+/*
+--------------------------------------------------------------------------------
+                                GET SDL TEXTURE
+--------------------------------------------------------------------------------
+*/
+SDL_Texture* Texture::get_sdl_texture( void )
+{
+    return( mTexture );
+}
+
+
 /*
 --------------------------------------------------------------------------------
                               SET / GET DIMENSIONS
@@ -378,87 +396,19 @@ void Texture::mod_alpha( Uint8 alpha )
 
 /*
 --------------------------------------------------------------------------------
-                                 INIT COLLIDERS
+                                  SPRITE SHEET
 --------------------------------------------------------------------------------
- *  This method will generate 'colliders' for the given surface, storing them
- *  in this texture's colliders vector array.  A collider, at least as used in
- *  this game, is a rectangle 1 pixel high with variable width.  The X position
- *  is also variable, and the Y position will match the 'row' of the given
- *  clip's colliders vector.
+ *  Textures drawn from the same image at a different color (the player's
+ *  white ship) can share a sheet rather than building their own
 */
-void Texture::generate_colliders( SDL_Surface *surface, int size, int frame )
+void Texture::set_sprite_sheet( SpriteSheet *sheet )
 {
-    /*  Grab a pointer to the surface pixels */
-    Uint32 *pixels = (Uint32*)surface->pixels;
-
-    /*  These will hold the RGBA values */
-    Uint8 r, g, b, a;
-
-    /*  Variable collider rect boundaries */
-    int left, right;
-    int width;
-
-    /*  Clear any colliders that might be in this frame's colliders vector */
-    mColliders[ frame ].clear();
-
-    /*  For each row of this part of the texture (clip) */
-    for( int cRow = 0; cRow < size; ++cRow )
-    {
-        /*  Init them both to impossible values */
-        left = right = -1;
-
-        /*  For each column of this texture's clip */
-        for( int cCol = 0; cCol < size; ++cCol )
-        {
-            /*  Increment the pixels pointer */
-            ++pixels;
-
-            /*
-             *  Grab the RGBA value for the correct pixel relative to the pixel
-             *  pointer's position.  To be honest, this was 90% brute-force
-             *  guesswork on my part.
-             */
-            SDL_GetRGBA( pixels[ (size * frame * size) ],
-                    surface->format, &r, &g, &b, &a );
-
-            /*  If the alpha of the pixel isn't zero */
-            if( a != 0 )
-            {
-                /*  If the left value has not been set to something real yet */
-                if( left < 0 )
-                    left = cCol;
-
-                /*  Just keep readjusting the rightmost boundary */
-                right = cCol;
-            }
-        }
-
-        /*  Get the width by, what else, subtracted left from right */
-        width = right - left;
-
-        /*  If there were no visible pixels, set the width to zero */
-        if( left < 0 )
-            width = 0;
-
-        /*  Create a new collider instance and fill it with data */
-        Collider collider = { left, cRow, width, 1 };
-
-        /*  Push it onto this frame's colliders vector */
-        mColliders[ frame ].push_back( collider );
-    }
-
+    mSheet = sheet;
 }
 
-
-/*
---------------------------------------------------------------------------------
-                               GET PIXEL COLLIDER
---------------------------------------------------------------------------------
- *  This is used outside this class to return a colliders vector
-*/
-std::vector<Collider> Texture::get_pixel_collider( int frame )
+SpriteSheet* Texture::get_sprite_sheet( void )
 {
-    return( mColliders[ frame ] );
+    return( mSheet );
 }
 
 
@@ -487,8 +437,10 @@ bool Texture::is_fading( void )
 */
 Uint8 Texture::get_alpha( void )
 {
-    Uint8 alpha;
-    SDL_GetTextureAlphaMod( mTexture, &alpha );
+    Uint8 alpha = 255;
+
+    if( mTexture != NULL )
+        SDL_GetTextureAlphaMod( mTexture, &alpha );
 
     return( alpha );
 }
@@ -514,7 +466,8 @@ void Texture::set_alpha( Uint8 alpha )
         a = alpha;
 
     /*  Modulate the texture's alpha value */
-    SDL_SetTextureAlphaMod( mTexture, a );
+    if( mTexture != NULL )
+        SDL_SetTextureAlphaMod( mTexture, a );
 }
 
 
@@ -525,12 +478,16 @@ void Texture::set_alpha( Uint8 alpha )
 */
 void Texture::get_color_mod( Uint8 *r, Uint8 *g, Uint8 *b )
 {
-    SDL_GetTextureColorMod( mTexture, r, g, b );
+    if( mTexture != NULL )
+        SDL_GetTextureColorMod( mTexture, r, g, b );
+    else
+        *r = *g = *b = 255;
 }
 
 void Texture::set_color_mod( Uint8 r, Uint8 g, Uint8 b )
 {
-    SDL_SetTextureColorMod( mTexture, r, g, b );
+    if( mTexture != NULL )
+        SDL_SetTextureColorMod( mTexture, r, g, b );
 }
 
 
@@ -545,7 +502,7 @@ void Texture::save_color_mod( void )
 {
     /*  Get the color mod from the texture */
     Uint8 r, g, b;
-    SDL_GetTextureColorMod( mTexture, &r, &g, &b );
+    get_color_mod( &r, &g, &b );
 
     /*  Create a new color from it */
     SDL_Color orig = { r, g, b, 255 };
@@ -570,7 +527,7 @@ void Texture::restore_color_mod( void )
     Uint8 b = mOriginalColorMod.b;
 
     /*  Set the texture color mod to those values */
-    SDL_SetTextureColorMod( mTexture, r, g, b );
+    set_color_mod( r, g, b );
 }
 
 
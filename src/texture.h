@@ -23,13 +23,16 @@ class Texture
         void free_texture( void );
 
         /*  Create a texture from a file */
-        bool create_texture_from_file( const char *path, bool clipping = false,
-                int cWidth = 0, int cHeight = 0, int cCount = 0 );
+        bool create_texture_from_file( const char *path,
+                SpriteSheet *sheet = NULL, int cSize = 0, int cCount = 0 );
 
         /*  Create a texture from a string of text */
         bool create_texture_from_string( TTF_Font *font, const char *string,
                 SDL_Color textColor );
 
+        /*  Get the SDL texture itself (NULL if there isn't one) */
+        SDL_Texture* get_sdl_texture( void );
+
         /*  Get default dimensions */
         int get_texture_width( void );
         int get_texture_height( void );
@@ -58,11 +61,9 @@ class Texture
         /*  Set max frames */
         void set_max_frames( int frames );
 
-        /*  Create colliders */
-        void generate_colliders( SDL_Surface *surface, int size, int frame );
-
-        /*  Get pixel collider */
-        std::vector<Collider> get_pixel_collider( int frame );
+        /*  Set / get the sprite sheet (clips and colliders) */
+        void set_sprite_sheet( SpriteSheet *sheet );
+        SpriteSheet* get_sprite_sheet( void );
 
         /*  Fade stuff */
         void set_fading( bool fade );
@@ -122,8 +123,8 @@ class Texture
         /*  The original values for the color mod */
         SDL_Color mOriginalColorMod;
 
-        /*  Colliders vector array */
-        std::vector<Collider> mColliders[ 30 ];
+        /*  Clips and colliders, if this is a sprite sheet (not owned) */
+        SpriteSheet *mSheet;
 };
 
 #endif
@@ -241,7 +241,7 @@ void start_transition( int toScreen, int directionKey )
     /*  Send the current ticks to the misc ticks */
     miscTicks = SDL_GetTicks();
 
-    Mix_PlayChannel( -1, soundEffectTransition, 0 );
+    play_sound( soundEffectTransition );
 }
 
 
@@ -11,6 +11,81 @@
 #endif
 
 
+/*
+ *  Where the asteroids are.  It only gets built on ticks where one of them
+ *  could be touching the player, and before they're culled, so it's only
+ *  good for the player's pass in update_main() and nobody else gets to see
+ *  it.
+ */
+static AsteroidGrid enemyGrid;
+
+/*  Enemies near the player this tick (kept around to save reallocating) */
+static std::vector<int> nearEnemies;
+
+/*  Where the player was the last time the enemies' clearances were updated */
+static SDL_Rect lastPlayerRect = { 0, 0, 0, 0 };
+static bool lastPlayerKnown = false;
+
+/*  What update_enemies() needs, and what it found */
+struct EnemyJob
+{
+    SDL_Rect pRect;             //  Where the player is
+    int pMoved;                 //  How far they've moved since last tick
+    SDL_atomic_t touching;      //  Enemies that could be touching them
+    SDL_atomic_t skipped;       //  Enemies ruled out by their clearance
+};
+
+
+/*
+--------------------------------------------------------------------------------
+                                 UPDATE ENEMIES
+--------------------------------------------------------------------------------
+ *  Job:  update enemies [begin, end) (movement, etc.) and see which of them
+ *  could be touching the player
+*/
+static void update_enemies( void *data, int begin, int end )
+{
+    EnemyJob *job = (EnemyJob*)data;
+    int skipped = 0;
+
+    enemies.update( begin, end );
+    int touching = enemies.update_clearance( begin, end, job->pRect,
+            job->pMoved, &skipped );
+
+    SDL_AtomicAdd( &job->touching, touching );
+    SDL_AtomicAdd( &job->skipped, skipped );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                            UPDATE ATARI EXPLOSIONS
+--------------------------------------------------------------------------------
+ *  Job:  update 'atari' explosions [begin, end) in the given color
+*/
+static void update_atari_explosions( void *data, int begin, int end )
+{
+    SDL_Color *color = (SDL_Color*)data;
+
+    for( int i = begin; i < end; ++i )
+        aExplosions[ i ].update( color );
+}
+
+
+/*
+--------------------------------------------------------------------------------
+                                  UPDATE DEBRIS
+--------------------------------------------------------------------------------
+ *  Job:  move and fade debris clouds [begin, end)
+*/
+static void update_debris( void *data, int begin, int end )
+{
+    DebrisPool *pool = (DebrisPool*)data;
+
+    pool->update( begin, end );
+}
+
+
 /*
 --------------------------------------------------------------------------------
                                   UPDATE MAIN
@@ -19,6 +94,41 @@
 */
 void update_main( void )
 {
+    /*  Get this tick's input, either live or from a replay, and act on it */
+    InputFrame input;
+    if( ! get_tick_input( input ) && headless )
+    {
+        /*  A headless replay is over once it runs out of input */
+        quit = true;
+        return;
+    }
+
+    /*
+     *  Stress tests honk constantly and power up whenever they can, so there
+     *  are kisses, kills and explosions going on whether or not anybody's
+     *  actually playing
+     */
+    if( stress )
+    {
+        input.buttons |= INPUT_HONK;
+        if( player.is_charged() )
+            input.buttons |= INPUT_POWER;
+    }
+
+    if( input.buttons & INPUT_MOUSE_MOVED )
+        player.move_mouse( input.mouseX, input.mouseY );
+
+    /*
+     *  Keyboard movement is read straight from the key state rather than from
+     *  events (no key repeat delay), so it happens once per tick right here
+     */
+    player.move_keyboard( input.keys );
+
+    if( input.buttons & INPUT_HONK )
+        player.honk();
+    if( input.buttons & INPUT_POWER )
+        player.init_power();
+
     /*  Warp speed update */
     if( warp )
         warp_update();
@@ -32,31 +142,38 @@ void update_main( void )
     /*  Add a few enemies */
     if( enemyDelay >= 120 )
     {
+        PROFILE_SCOPE( PROF_SPAWN );
+
         /*
          *  Every tick (60 per second by default), there is a one in
          *  (15 * warpSpeed) chance that the program will 'consider' spawning
          *  an enemy.
          */
-        for( int i = 0; i < ( rand() % ( 15 * warpSpeed ) ) + 1; ++i )
+        int tries = rng[ RNG_SPAWN ].range( 15 * warpSpeed ) + 1;
+
+        /*  Stress tests consider that many times over */
+        tries *= stressFactor;
+
+        for( int i = 0; i < tries; ++i )
         {
             /*  If the player is is not powered, 1/80 chance of an enemy */
             if( ! player.is_powered() )
             {
-                if( rand() % 80 == 0 )
+                if( rng[ RNG_SPAWN ].chance( 80 ) )
                     load_enemy();
             }
 
             /*  If they are powered, 1/40 chance (more enemies) */
             else
             {
-                if( rand() % 40 == 0 )
+                if( rng[ RNG_SPAWN ].chance( 40 ) )
                     load_enemy();
             }
         }
     }
 
     /*  Tilt the player's ship according to movement */
-    player.tilt();
+    player.tilt( input.relX );
 
     /*  Get the player's general area/position */
     SDL_Rect pRect = player.get_rect();
@@ -64,63 +181,100 @@ void update_main( void )
     /*  Update the enemies */
     if( enemies.size() > 0 )
     {
-        /*  Create the enemies vector iterator */
-        std::vector<Enemy>::iterator enemy;
+        PROFILE_SCOPE( PROF_ENEMIES );
 
-        /*  Update the enemies */
-        for( enemy = enemies.begin(); enemy != enemies.end(); )
+        /*
+         *  How far the player has moved since last tick, along whichever axis
+         *  they moved furthest on.  The first time through, we don't know, so
+         *  call it far enough that every enemy gets measured.
+         */
+        int pMoved = BWIDTH + BHEIGHT;
+        if( lastPlayerKnown )
         {
-            /*  Update the enemy (movement, etc.) */
-            enemy->update();
+            int movedX = abs( pRect.x - lastPlayerRect.x );
+            int movedY = abs( pRect.y - lastPlayerRect.y );
+            pMoved = ( movedX > movedY ) ? movedX : movedY;
+        }
+        lastPlayerRect = pRect;
+        lastPlayerKnown = true;
 
-            /*  Get the enemy's general rectangle */
-            SDL_Rect eRect = enemy->get_rect();      //  lololol erect
+        /*  Move every enemy, spread out over the job pool */
+        EnemyJob job;
+        job.pRect = pRect;
+        job.pMoved = pMoved;
+        SDL_AtomicSet( &job.touching, 0 );
+        SDL_AtomicSet( &job.skipped, 0 );
 
-            /*  If the player and enemy are in very close proximity */
-            if( check_collision_box( pRect, eRect ) )
-            {
-                /*  If the player honks at the asteroid */
-                if( player.is_honking() )
-                    enemy->kiss();
+        JobGroup group;
+        jobs.run( group, update_enemies, &job, (int)enemies.size(), 32 );
+        jobs.wait( group );
 
-                /*  Grab the player's colliders vector */
-                std::vector<Collider> pCollider = player.get_pixel_collider(
-                        player.get_current_frame() );
-                
-                /*  Grab this enemy's colliders vector */
-                std::vector<Collider> eCollider = enemy->get_pixel_collider(
-                        enemy->get_current_frame() );
+        collisionChecks += enemies.size();
+        collisionSkips += SDL_AtomicGet( &job.skipped );
 
+        /*
+         *  If any of them could be touching the player, sort them into the
+         *  grid and pull out the ones that came anywhere near the player this
+         *  tick.  Those are the only ones that can be kissed or hit, so
+         *  everything else gets left alone.  They come back in index order,
+         *  same as if we'd gone through them all.
+         */
+        if( SDL_AtomicGet( &job.touching ) > 0 )
+        {
+            PROFILE_SCOPE( PROF_BROADPHASE );
+            enemyGrid.build( enemies );
+            enemyGrid.query_rect( pRect, nearEnemies );
+        }
+        else
+            nearEnemies.clear();
 
-                /*  Check for collision between the sets of colliders */
-                if( check_collision_colliders( pCollider, eCollider ) )
+        /*  The player's mask (the white ship's is the same shape) */
+        PixelMask &pMask =
+            player.get_pixel_mask( player.get_current_frame() );
+
+        for( int n = 0; n < (int)nearEnemies.size(); ++n )
+        {
+            int i = nearEnemies[ n ];
+            SDL_Rect eRect = enemies.get_rect( i );
+
+            /*  If the player honks at the asteroid where it is now */
+            if( player.is_honking() && check_collision_box( pRect, eRect ) )
+                enemies.kiss( i );
+
+            /*
+             *  Check for collision between their pixels anywhere along the
+             *  asteroid's path this tick, so it can't jump over the player
+             *  at warp speed
+             */
+            bool touching;
+            {
+                PROFILE_SCOPE( PROF_COLLISIONS );
+                touching = check_collision_mask_sweep( pMask, pRect.x,
+                        pRect.y, enemies.get_pixel_mask( i ), eRect.x,
+                        enemies.get_prev_y( i ), eRect.y );
+            }
+
+            /*  If their pixels touched */
+            if( touching )
+            {
+                /*  If the player is powered up, destroy the enemy */
+                if( player.is_powered() )
+                    enemies.kill( i );
+
+                //  Otherwise, under normal circumstances, kill the player
+                else if( ! noDeath &&
+                        player.is_alive() &&
+                        enemies.is_alive( i ) &&
+                        ! player.is_invulnerable() )
                 {
-                    /*  If the player is powered up, destroy the enemy */
-                    if( player.is_powered() )
-                        enemy->kill();
-
-                    //  Otherwise, under normal circumstances, kill the player
-                    else if( player.is_alive() &&
-                            enemy->is_alive() &&
-                            ! player.is_invulnerable() )
-                    {
-                        player.kill();
-                    }
+                    player.kill();
                 }
             }
-
-            /*  If the enemy has gone beyond the visible play area, erase it */
-            if( enemy->get_pos_y() > BHEIGHT )
-                enemies.erase( enemy );
-
-            /*  If the enemy is dead and gone, erase it */
-            else if( ! enemy->is_alive() && ! enemy->is_exploding() )
-                enemies.erase( enemy );
-
-            /*  Otherwise, move on to the next enemy in the vector */
-            else
-                ++enemy;
         }
+
+        /*  Clean up the enemies that are off the screen or dead and gone */
+        PROFILE_SCOPE( PROF_CLEANUP );
+        enemies.cull();
     }
 
 
@@ -157,39 +311,51 @@ void update_main( void )
     if( player.is_powered() )
         player.power_update();
 
-    /*  Update score string and texture */
-    snprintf( currentScoreString, 9, "%06d", currentScore );
-    scoreText->create_texture_from_string( gFontTiny, currentScoreString,
-            colors[ COLOR_WHITE ] );
-
     /*  Wait a couple of seconds before spawning enemies */
     if( enemyDelay < 121 )
         ++enemyDelay;
 
-    /*  Update the starfield */
-    starfield->update();
+    /*
+     *  The starfield and the explosions ('atari' ones and debris) don't touch
+     *  one another, so the explosions go out to the job pool while we do the
+     *  starfield right here.  The player has to wait for them, since it looks
+     *  at its debris.
+     */
+    JobGroup effects;
+    {
+        PROFILE_SCOPE( PROF_EXPLOSIONS );
 
-    /*  The player update function - just controls the honk, really */
-    player.update();
+        /*  Get rid of the ones that are dead */
+        for( size_t a = 0; a < aExplosions.size(); ++a )
+        {
+            if( aExplosions[ a ].is_done() )
+                aExplosions.remove( a );
+        }
+        aExplosions.compact();
 
-    /*  Create an iterator for the 'atari' explosions vector */
-    std::vector<AtariExplosion>::iterator a;
+        /*  Update the rest */
+        jobs.run( effects, update_atari_explosions,
+                player.get_special_color(), (int)aExplosions.size(), 8 );
 
-    /*  Iterate through the vector */
-    for( a = aExplosions.begin(); a != aExplosions.end(); )
+        /*  Move the debris along */
+        jobs.run( effects, update_debris, &debris,
+                debris.get_cloud_count(), 4 );
+    }
+
+    /*  Update the starfield */
     {
-        /*  Erase the ones that are dead */
-        if( a->is_done() )
-            aExplosions.erase( a );
+        PROFILE_SCOPE( PROF_STARFIELD );
+        starfield->update();
+    }
 
-        /*  Update the ones that aren't, then move on */
-        else
-        {
-            a->update( player.get_special_color() );
-            ++a;
-        }
+    {
+        PROFILE_SCOPE( PROF_EXPLOSIONS );
+        jobs.wait( effects );
     }
 
+    /*  The player update function - just controls the honk, really */
+    player.update();
+
     /*  We do this here so that the pause menu will display the correct text */
     if( gamePaused )
         gamePaused = false;
@@ -198,7 +364,10 @@ void update_main( void )
     update_osd();
 
     /*  Update the kissKills object */
-    kissKills.update();
+    {
+        PROFILE_SCOPE( PROF_KISSKILLS );
+        kissKills.update();
+    }
 
 }
 
@@ -17,6 +17,8 @@
 */
 const unsigned int DEFAULT_FPS = 60;    //  Default FPS
 unsigned int FPS = DEFAULT_FPS;
+const unsigned int MAX_TICKS_PER_FRAME = 5;     //  Catch-up limit per frame
+float tickInterpolation = 1.0f;                 //  0 = last tick, 1 = current
 
 
 /*
@@ -28,7 +30,11 @@ const std::string VERSION = "0.92";                     //  Version string
 const std::string DAT_FILE_PATH = "data/scores.dat";    //  Scores file
 const std::string TXT_FILE_PATH = "data/scores.txt";    //  Scores txt file
 const std::string STORY_FILE_PATH = "data/story.txt";   //  Story file
+std::string profileOutPath;                             //  Profile CSV file
+std::string replayPath;                                 //  Replay file
 char currentScoreString[ 10 ];                          //  Current score string
+char highScoreString[ 10 ];                             //  High score string
+char osdString[ 32 ];                                   //  OSD text
 
 
 /*
@@ -50,6 +56,7 @@ int BHEIGHT = WHEIGHT;                      //  Play boundary height
 --------------------------------------------------------------------------------
 */
 int currentScreen = SCREEN_MENU;    //  Set to the menu screen by default
+int replayMode = REPLAY_OFF;        //  Not recording or replaying by default
 int enemyDelay = 0;                 //  Delay before we start spawning enemies
 int warpSpeed = 1;                  //  Speed at which the player travels
 int maxWarpSpeed = 1;               //  Max warp speed; modified later
@@ -59,6 +66,16 @@ Uint32 currentScore = 0;            //  Current score
 Uint32 chargeScore = 0;             //  Score tracker for the charge meter
 Uint32 extraLifeScore = 0;          //  Score tracker for earning an extra life
 Uint32 miscTicks = 0;               //  Random ticks tracker
+Uint32 headlessFrames = 36000;      //  Headless ticks (10 minutes of play)
+Uint64 rngSeed = 0;                 //  Seed given to the random streams
+Uint8 pendingButtons = 0;           //  INPUT_* bits waiting for the next tick
+Uint8 osdAlpha = 0;                 //  OSD fades out from 255
+Uint32 screenFlashes = 0;           //  Goes up by one for every screen flash
+int jobThreads = -1;                //  Worker threads (-1 for one per core)
+int stressFactor = 1;               //  Spawn rate multiplier (--stress)
+const int MAX_STRESS_FACTOR = 1000; //  Past this, every pixel gets a star
+Uint64 collisionChecks = 0;         //  Asteroid checks due (one per tick each)
+Uint64 collisionSkips = 0;          //  Checks skipped thanks to clearance
 Uint32 gPixelFormat = 0;            //  Surface pixel format
 
 
@@ -126,11 +143,15 @@ SDL_Color borderColor = { 255, 255, 255, 255 };     //  Default border color
 */
 bool quit = false;              //  Has the player quit?
 bool limitFPS = false;          //  Do we limit fps?
-bool screenFlash = false;       //  Are we flashing the screen?
 bool warp = false;              //  Is the player currently warping up?
 bool gamePaused = false;        //  Is the game paused?
 bool playMusic = true;          //  Do we play music?
 bool playSound = true;          //  Do we play sound effects?
+bool headless = false;          //  Simulate without window, renderer or audio
+bool seedGiven = false;         //  Whether the user gave us a seed to use
+bool threaded = false;          //  Simulate and render on separate threads
+bool stress = false;            //  Stress test (--stress)
+bool noDeath = false;           //  The player can't die (--no-death)
 
 
 /*
@@ -147,16 +168,24 @@ Texture *panelBackground = NULL;        //  Main panel texture
 Texture *panelButtons = NULL;           //  Panel buttons texture
 
 
+/*  ----------  Sprite sheets   ---------------*/
+SpriteSheet *playerSheet = NULL;        //  Player's ship
+SpriteSheet *enemySheets[ ASTEROID_SCALES + 1 ];    //  Asteroids, per scale
+
+
+/*  ----------  Glyph atlases   ---------------*/
+GlyphAtlas *gFontAtlas = NULL;          //  Default font's glyphs
+GlyphAtlas *gFontSmallAtlas = NULL;     //  Smaller font's glyphs
+GlyphAtlas *gFontTinyAtlas = NULL;      //  Smallest font's glyphs
+
+
 /*  ----------  Text textures   ---------------*/
 Texture *gameOverText = NULL;           //  Game over
-Texture *scoreText = NULL;              //  Current score
-Texture *highScoreText = NULL;          //  Highest score
 Texture *scoreQualifyText1 = NULL;      //  Score screen text hint 1
 Texture *scoreQualifyText2 = NULL;      //  Score screen text hint 2
 Texture *scoreQualifyText3 = NULL;      //  Score screen text hint 3
 Texture *enterHighScoreText1 = NULL;    //  Enter high score screen text hint 1
 Texture *enterHighScoreText2 = NULL;    //  Enter high score screen text hint 2
-Texture *OSD = NULL;                    //  Generic OSD text texture
 
 
 /*  ---------   Target textures ------------- */
@@ -185,8 +214,13 @@ Menu *menuScreen = NULL;        //  Main menu screen
 */
 Player player;                              //  The player
 Panel panel;                                //  The panel
-std::vector<Enemy> enemies;                 //  The asteroids
-std::vector<AtariExplosion> aExplosions;    //  'Atari' explosions
+Asteroids enemies;                          //  The asteroids
+SpriteBatch spriteBatch;                    //  Batched sprite drawing
+DenseArray<AtariExplosion> aExplosions;     //  'Atari' explosions
+DebrisPool debris;                          //  Every explosion's particles
 Tail tail;                                  //  Tail displayed behind player
 Transition transition;                      //  Transition struct instance
 KissKill kissKills;                         //  Kiss/kill OSDs
+Random rng[ TOTAL_RNG_STREAMS ];            //  Random number streams
+Profiler profiler;                          //  Frame phase timings
+JobPool jobs;                               //  Worker threads
@@ -10,15 +10,27 @@
 #define UTIL_H
 
 #include <stdio.h>              //  For printf, file IO, etc.
-#include <time.h>               //  Used to seed rand
+#include <stdlib.h>             //  For strtoul and friends
+#include <string.h>             //  For memcmp, strcmp
+#include <time.h>               //  Used to seed random
 #include <vector>               //  Handy
 #include <list>                 //  Also handy
+#include <deque>                //  Job queues
+#include <algorithm>            //  std::sort
 #include <string>               //  I'm lazy, so sue me
 #include <SDL2/SDL.h>           //  SDL stuff
 #include <SDL2/SDL_image.h>     //  Image loading
 #include <SDL2/SDL_mixer.h>     //  SFX / music
 #include <SDL2/SDL_ttf.h>       //  Font stuff
 
+/*
+ *  The sprite batch, the glyph atlases and the starfield all draw with
+ *  SDL_RenderGeometry(), which SDL only has from 2.0.18 on
+ */
+#if ! SDL_VERSION_ATLEAST( 2, 0, 18 )
+#error "Belted needs SDL 2.0.18 or later (for SDL_RenderGeometry)"
+#endif
+
 
 /*
 --------------------------------------------------------------------------------
@@ -40,6 +52,21 @@ struct Collider
 };
 
 
+/*
+ *  PixelMask struct
+ *      One bit for each pixel of a sprite frame, set wherever the pixel isn't
+ *      see-through.  Each row takes up 'words' 64-bit words, with the row's
+ *      leftmost pixel in the lowest bit of its first word.
+ */
+struct PixelMask
+{
+    int w;                      //  Width, in pixels
+    int h;                      //  Height, in pixels
+    int words;                  //  Words per row
+    std::vector<Uint64> bits;   //  h * words words, row by row
+};
+
+
 /*
  *  Circle struct
  *      Theoretically used for circular collision detection, though I don't
@@ -90,6 +117,22 @@ struct ScoreRecord
 };
 
 
+/*
+ *  InputFrame struct
+ *      Everything the player did that matters to gameplay during one tick.
+ *      This is what gets written to / read from replay files.
+ */
+struct InputFrame
+{
+    Sint16 mouseX;              //  Mouse position
+    Sint16 mouseY;
+    Sint16 relX;                //  Relative mouse motion since last tick
+    Sint16 relY;
+    Uint8 buttons;              //  INPUT_* bits
+    Uint8 keys;                 //  INPUT_KEY_* bits
+};
+
+
 /*
 --------------------------------------------------------------------------------
                                      ENUMS
@@ -129,6 +172,45 @@ enum colors
 };
 
 
+/*  Bits for the buttons field of the InputFrame struct */
+enum inputButtons
+{
+    INPUT_MOUSE_MOVED = 0x01,   //  Mouse moved, so move the ship to it
+    INPUT_HONK = 0x02,          //  Honk the horn
+    INPUT_POWER = 0x04          //  Activate the charge power
+};
+
+
+/*  Bits for the keys field of the InputFrame struct (held arrow keys) */
+enum inputKeys
+{
+    INPUT_KEY_LEFT = 0x01,
+    INPUT_KEY_RIGHT = 0x02,
+    INPUT_KEY_UP = 0x04,
+    INPUT_KEY_DOWN = 0x08
+};
+
+
+/*  Whether we're recording or playing back input */
+enum replayModes
+{
+    REPLAY_OFF,                 //  Neither; just play
+    REPLAY_RECORD,              //  Write every tick's input to a file
+    REPLAY_PLAY                 //  Read every tick's input from a file
+};
+
+
+/*  Independent random number streams, one per subsystem */
+enum rngStreams
+{
+    RNG_GAMEPLAY,               //  Asteroid size, speed, position, etc.
+    RNG_SPAWN,                  //  When asteroids get spawned
+    RNG_EFFECTS,                //  Explosions and other eye candy
+    RNG_STARFIELD,              //  The stars in the background
+    TOTAL_RNG_STREAMS
+};
+
+
 /*  Easier to remember than '0 is left, 2 is up', etc. */
 enum directionKeyEnum
 {
@@ -150,7 +232,11 @@ extern const std::string VERSION;           //  Version number string
 extern const std::string DAT_FILE_PATH;     //  scores.dat file path
 extern const std::string TXT_FILE_PATH;     //  scores.txt file path
 extern const std::string STORY_FILE_PATH;   //  story.txt file path
+extern std::string profileOutPath;          //  Per-frame profile CSV path
+extern std::string replayPath;              //  Replay file to record / play
 extern char currentScoreString[ 10 ];       //  String for current score
+extern char highScoreString[ 10 ];          //  String for the high score
+extern char osdString[ 32 ];                //  What the OSD says
 
 
 
@@ -161,6 +247,8 @@ extern char currentScoreString[ 10 ];       //  String for current score
 */
 extern const unsigned int DEFAULT_FPS;      //  Default frames per second
 extern unsigned int FPS;                    //  Current fps
+extern const unsigned int MAX_TICKS_PER_FRAME;  //  Most ticks run per frame
+extern float tickInterpolation;             //  Render position between ticks
 
 extern const int DEFAULT_WINDOW_WIDTH;      //  Default window width
 extern const int DEFAULT_WINDOW_HEIGHT;     //  Default window height
@@ -170,6 +258,7 @@ extern int BWIDTH;                          //  Current boundary width
 extern int BHEIGHT;                         //  Current boundary height
 
 extern int currentScreen;                   //  Current screen
+extern int replayMode;                      //  Recording / replaying input
 extern int enemyDelay;                      //  Delay before enemies start down
 extern int warpSpeed;                       //  How fast the game is moving
 extern int maxWarpSpeed;                    //  How fast the game can move
@@ -179,6 +268,16 @@ extern Uint32 currentScore;                 //  Current player score
 extern Uint32 chargeScore;                  //  Score tracker for the charge
 extern Uint32 extraLifeScore;               //  Score tracker for 1ups
 extern Uint32 miscTicks;                    //  Misc tick tracker
+extern Uint32 headlessFrames;               //  Ticks to run in headless mode
+extern Uint64 rngSeed;                      //  Seed the streams were given
+extern Uint8 pendingButtons;                //  Buttons pressed since last tick
+extern Uint8 osdAlpha;                      //  Current OSD opacity
+extern Uint32 screenFlashes;                //  Screen flashes asked for so far
+extern int jobThreads;                      //  Worker threads to start
+extern int stressFactor;                    //  Stress test spawn multiplier
+extern const int MAX_STRESS_FACTOR;         //  Biggest --stress allowed
+extern Uint64 collisionChecks;              //  Asteroid checks due this run
+extern Uint64 collisionSkips;               //  How many of them were skipped
 
 extern Uint32 gPixelFormat;                 //  Pixel format
 
@@ -190,11 +289,15 @@ extern Uint32 gPixelFormat;                 //  Pixel format
 */
 extern bool quit;           //  Does the player want to quit?
 extern bool limitFPS;       //  Do we deliberately limit the FPS?
-extern bool screenFlash;    //  Are we going to flash the screen?
 extern bool warp;           //  Is the player warping?
 extern bool gamePaused;     //  Is the game paused?
 extern bool playMusic;      //  Do we play music?
 extern bool playSound;      //  Do we play sound effects?
+extern bool headless;       //  Are we simulating with no window / audio?
+extern bool seedGiven;      //  Did the user pass in a seed?
+extern bool threaded;       //  Is the simulation on its own thread?
+extern bool stress;         //  Are we running a stress test?
+extern bool noDeath;        //  Is the player immune to asteroids?
 
 
 /*
@@ -279,16 +382,22 @@ extern Texture *enemyTexture;           //  Asteroids   spritesheet
 extern Texture *panelBackground;        //  Main panel texture
 extern Texture *panelButtons;           //  Panel buttons spritesheet
 
+/*  ---------   Sprite sheets   -------- */
+extern SpriteSheet *playerSheet;        //  Player's ship
+extern SpriteSheet *enemySheets[ ASTEROID_SCALES + 1 ];    //  Per scale
+
+/*  ---------   Glyph atlases   -------- */
+extern GlyphAtlas *gFontAtlas;          //  Default font's glyphs
+extern GlyphAtlas *gFontSmallAtlas;     //  Smaller font's glyphs
+extern GlyphAtlas *gFontTinyAtlas;      //  Smallest font's glyphs
+
 /*  ---------   Text textures   -------- */
 extern Texture *gameOverText;           //  Game over
-extern Texture *scoreText;              //  Current score text
-extern Texture *highScoreText;          //  Highest score text
 extern Texture *scoreQualifyText1;      //  Score qualify screen text hint 1
 extern Texture *scoreQualifyText2;      //  Score qualify screen text hint 2
 extern Texture *scoreQualifyText3;      //  Score qualify screen text hint 3
 extern Texture *enterHighScoreText1;    //  Enter high score text hint 1
 extern Texture *enterHighScoreText2;    //  Enter high score text hint 2
-extern Texture *OSD;                    //  Generic OSD text texture
 
 /*  ---------   Render target textures  ---*/
 extern SDL_Texture *transTexture1;      //  Target texture for the 'from' screen
@@ -314,11 +423,16 @@ extern Menu *menuScreen;            //  Main menu screen
 --------------------------------------------------------------------------------
 */
 extern Player player;                               //  The player
-extern std::vector<Enemy> enemies;                  //  The asteroids
+extern Asteroids enemies;                           //  The asteroids
+extern SpriteBatch spriteBatch;                     //  Batched sprite drawing
 extern Panel panel;                                 //  The panel at the bottom
-extern std::vector<AtariExplosion> aExplosions;     //  'Atari' explosions
+extern DenseArray<AtariExplosion> aExplosions;      //  'Atari' explosions
+extern DebrisPool debris;                   //  Every explosion's particles
 extern Tail tail;                                   //  Tail that follows player
 extern Transition transition;                       //  Global transition struct
 extern KissKill kissKills;                          //  kiss/kill OSDs
+extern Random rng[ TOTAL_RNG_STREAMS ];             //  Random number streams
+extern Profiler profiler;                           //  Frame phase timings
+extern JobPool jobs;                                //  Worker threads
 
 #endif